@@ -2,10 +2,11 @@
 
 #include <iostream>
 #include <fstream>
-#include <sstream>
 #include <algorithm>
 
 #include "DatabaseManager.h"
+#include "MappedFile.h"
+#include "Csv.h"
 
 using namespace std;
 
@@ -31,12 +32,28 @@ const string AssignmentManager::MSG_SUCCESS_STUDENT_UNENROLLED =
     "Успішно видалено студента з предмету";
 
 AssignmentManager::AssignmentManager()
+    : m_loadState(LoadState::NotLoaded)
 {
-    loadFromFile();
+}
+
+bool AssignmentManager::open()
+{
+    if (m_loadState == LoadState::Loaded)
+    {
+        return true;
+    }
+    return loadFromFile();
+}
+
+LoadState AssignmentManager::getLoadState() const
+{
+    return m_loadState;
 }
 
 bool AssignmentManager::assignToSubject(const string& teacherId, const string& subId)
 {
+    open();
+
     if (m_teacherSubjects.find(teacherId) != m_teacherSubjects.end())
     {
         cout << MSG_ERROR_TEACHER_HAS_SUBJECT << endl;
@@ -59,6 +76,8 @@ bool AssignmentManager::assignToSubject(const string& teacherId, const string& s
 
 bool AssignmentManager::removeFromSubject(const string& teacherId)
 {
+    open();
+
     auto it = m_teacherSubjects.find(teacherId);
     if (it == m_teacherSubjects.end())
     {
@@ -98,6 +117,8 @@ map<string, string> AssignmentManager::getAllTeacherAssignments() const
 
 bool AssignmentManager::enrollStudentInSubject(const string& studentId, const string& subjectId)
 {
+    open();
+
     if (isStudentEnrolled(studentId, subjectId))
     {
         cout << MSG_ERROR_STUDENT_ALREADY_ENROLLED << endl;
@@ -114,6 +135,8 @@ bool AssignmentManager::enrollStudentInSubject(const string& studentId, const st
 
 bool AssignmentManager::unenrollStudentFromSubject(const string& studentId, const string& subjectId)
 {
+    open();
+
     if (!isStudentEnrolled(studentId, subjectId))
     {
         cout << "Помилка: Студент не записаний на цей предмет" << endl;
@@ -171,7 +194,7 @@ string AssignmentManager::getDetailedTeachingStatus(const string& teacherId, Dat
     string subjectId = it->second;
     if (dbManager)
     {
-        Subject* subject = dbManager->GetSubject(subjectId);
+        optional<Subject> subject = dbManager->GetSubject(subjectId);
         if (subject)
         {
             return "Викладач призначений на предмет: " + subject->getSubjectName() +
@@ -201,10 +224,11 @@ void AssignmentManager::debugPrintAllAssignments() const
 
 bool AssignmentManager::loadFromFile()
 {
-    ifstream file("assignments.csv");
-    if (!file.is_open())
+    MappedFile file;
+    if (!file.Open("assignments.csv"))
     {
-        cout << "Інформація: Файл призначень не знайдений. Буде створений новий при збереженні." << endl;
+        cout << "Інформація: Файл призначень не знайдений. Буде створений новий при збереженні.\n";
+        m_loadState = LoadState::Loaded;
         return true;
     }
 
@@ -213,42 +237,40 @@ bool AssignmentManager::loadFromFile()
     m_studentSubjects.clear();
     m_subjectStudents.clear();
 
-    string line;
     int teacherCount = 0;
     int studentCount = 0;
 
-    while (getline(file, line))
+    CsvReader reader(file.GetView(), '|');
+    while (reader.Next())
     {
-        if (line.empty())
+        if (reader.GetFieldCount() != 3)
         {
             continue;
         }
 
-        stringstream ss(line);
-        string type, id1, id2;
+        string_view type = reader.GetField(0);
+        string id1(reader.GetField(1));
+        string id2(reader.GetField(2));
 
-        if (getline(ss, type, '|') &&
-            getline(ss, id1, '|') &&
-            getline(ss, id2))
+        if (type == "T")
         {
-            if (type == "T")
-            {
-                m_teacherSubjects[id1] = id2;
-                m_subjectTeachers[id2] = id1;
-                teacherCount++;
-            }
-            else if (type == "S")
-            {
-                m_studentSubjects[id1].push_back(id2);
-                m_subjectStudents[id2].push_back(id1);
-                studentCount++;
-            }
+            m_teacherSubjects[id1] = id2;
+            m_subjectTeachers[id2] = id1;
+            teacherCount++;
+        }
+        else if (type == "S")
+        {
+            m_studentSubjects[id1].push_back(id2);
+            m_subjectStudents[id2].push_back(id1);
+            studentCount++;
         }
     }
 
-    file.close();
-    cout << "Завантажено " << teacherCount << " призначень викладачів та "
-         << studentCount << " записів студентів з файлу" << endl;
+    file.Close();
+    m_loadState = LoadState::Loaded;
+    // Одним записом у потік: файл може завантажуватись паралельно з іншими джерелами
+    cout << "Завантажено " + to_string(teacherCount) + " призначень викладачів та " +
+            to_string(studentCount) + " записів студентів з файлу\n";
     return true;
 }
 
@@ -263,10 +285,15 @@ bool AssignmentManager::saveToFile() const
 
     int teacherCount = 0;
     int studentCount = 0;
+    string line;
 
     for (const auto& assignment : m_teacherSubjects)
     {
-        file << "T" << "|" << assignment.first << "|" << assignment.second << "\n";
+        line = "T|";
+        CsvWriter::AppendField(line, assignment.first, '|');
+        line += '|';
+        CsvWriter::AppendField(line, assignment.second, '|');
+        file << line << "\n";
         teacherCount++;
     }
 
@@ -274,7 +301,11 @@ bool AssignmentManager::saveToFile() const
     {
         for (const auto& subjectId : enrollment.second)
         {
-            file << "S" << "|" << enrollment.first << "|" << subjectId << "\n";
+            line = "S|";
+            CsvWriter::AppendField(line, enrollment.first, '|');
+            line += '|';
+            CsvWriter::AppendField(line, subjectId, '|');
+            file << line << "\n";
             studentCount++;
         }
     }
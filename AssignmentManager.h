@@ -10,6 +10,8 @@
 #include <map>
 #include <vector>
 
+#include "LoadState.h"
+
 namespace University {
 
 // Попереднє оголошення
@@ -28,6 +30,7 @@ private:
     std::map<std::string, std::string> m_subjectTeachers;              ///< Мапа ID предмета до ID викладача
     std::map<std::string, std::vector<std::string>> m_studentSubjects; ///< Мапа ID студента до списку ID предметів
     std::map<std::string, std::vector<std::string>> m_subjectStudents; ///< Мапа ID предмета до списку ID студентів
+    LoadState m_loadState;                                             ///< Стан завантаження даних з файлу
 
     // Константи повідомлень
     static const std::string MSG_ERROR_TEACHER_HAS_SUBJECT;        ///< Помилка: Викладач вже має призначений предмет
@@ -40,12 +43,6 @@ private:
     static const std::string MSG_SUCCESS_STUDENT_ENROLLED;         ///< Успіх: Студента записано на предмет
     static const std::string MSG_SUCCESS_STUDENT_UNENROLLED;       ///< Успіх: Студента видалено з предмету
 
-    /**
-     * @brief Завантажує дані призначень з файлу
-     * @return true якщо завантаження успішне, false в іншому випадку
-     */
-    bool loadFromFile();
-
     /**
      * @brief Зберігає дані призначень у файл
      * @return true якщо збереження успішне, false в іншому випадку
@@ -55,10 +52,30 @@ private:
 public:
     /**
      * @brief Конструктор за замовчуванням
-     * @details Ініціалізує менеджер та завантажує існуючі дані з файлу
+     * @details Створює порожній менеджер; дані завантажує open()
      */
     AssignmentManager();
 
+    /**
+     * @brief Завантажує дані призначень з файлу, якщо їх ще не завантажено
+     * @details Зміни призначень викликають його автоматично, щоб збереження
+     * не перезаписало файл неповними даними
+     * @return true якщо дані завантажено (зараз або раніше), false в іншому випадку
+     */
+    bool open();
+
+    /**
+     * @brief Повертає стан завантаження даних
+     * @return Стан завантаження
+     */
+    LoadState getLoadState() const;
+
+    /**
+     * @brief Завантажує дані призначень з файлу
+     * @return true якщо завантаження успішне, false в іншому випадку
+     */
+    bool loadFromFile();
+
     // Методи для призначення викладачів на предмети
 
     /**
@@ -0,0 +1,127 @@
+#include "BackgroundFlusher.h"
+
+using namespace std;
+
+namespace University {
+
+BackgroundFlusher::BackgroundFlusher(function<bool()> flushCallback,
+                                     chrono::milliseconds window, size_t batchSize)
+    : m_flushCallback(std::move(flushCallback)), m_window(window),
+      m_batchSize(batchSize > 0 ? batchSize : 1),
+      m_requestedSequence(0), m_durableSequence(0), m_attemptedSequence(0),
+      m_flushRequested(false), m_stopping(false)
+{
+    m_thread = thread(&BackgroundFlusher::Run, this);
+}
+
+BackgroundFlusher::~BackgroundFlusher()
+{
+    {
+        lock_guard<mutex> lock(m_mutex);
+        m_stopping = true;
+    }
+    m_wakeCondition.notify_all();
+    if (m_thread.joinable())
+    {
+        m_thread.join();
+    }
+}
+
+uint64_t BackgroundFlusher::NotifyMutation()
+{
+    uint64_t sequence;
+    bool wake;
+    {
+        lock_guard<mutex> lock(m_mutex);
+        sequence = ++m_requestedSequence;
+        // Перша зміна відкриває вікно групування, повна пачка закриває його достроково
+        uint64_t pending = m_requestedSequence - m_durableSequence;
+        wake = pending == 1 || pending >= m_batchSize;
+    }
+    if (wake)
+    {
+        m_wakeCondition.notify_all();
+    }
+    return sequence;
+}
+
+bool BackgroundFlusher::Flush()
+{
+    uint64_t sequence;
+    {
+        lock_guard<mutex> lock(m_mutex);
+        sequence = m_requestedSequence;
+        m_flushRequested = true;
+    }
+    m_wakeCondition.notify_all();
+    return WaitDurable(sequence);
+}
+
+bool BackgroundFlusher::WaitDurable(uint64_t sequence)
+{
+    unique_lock<mutex> lock(m_mutex);
+    m_durableCondition.wait(lock, [&] { return m_attemptedSequence >= sequence || m_stopping; });
+    return m_durableSequence >= sequence;
+}
+
+uint64_t BackgroundFlusher::GetRequestedSequence()
+{
+    lock_guard<mutex> lock(m_mutex);
+    return m_requestedSequence;
+}
+
+void BackgroundFlusher::Run()
+{
+    unique_lock<mutex> lock(m_mutex);
+    while (true)
+    {
+        m_wakeCondition.wait(lock, [this]
+        {
+            return m_stopping || m_flushRequested || m_requestedSequence > m_durableSequence;
+        });
+
+        if (m_requestedSequence == m_durableSequence)
+        {
+            m_flushRequested = false;
+            m_attemptedSequence = m_durableSequence;
+            m_durableCondition.notify_all();
+            if (m_stopping)
+            {
+                break;
+            }
+            continue;
+        }
+
+        // Вікно групування: чекаємо, доки накопичаться інші зміни
+        m_wakeCondition.wait_for(lock, m_window, [this]
+        {
+            return m_stopping || m_flushRequested ||
+                   m_requestedSequence - m_durableSequence >= m_batchSize;
+        });
+
+        uint64_t target = m_requestedSequence;
+        m_flushRequested = false;
+        lock.unlock();
+        bool success = m_flushCallback();
+        lock.lock();
+
+        m_attemptedSequence = target;
+        if (success)
+        {
+            m_durableSequence = target;
+        }
+        m_durableCondition.notify_all();
+
+        if (!success)
+        {
+            if (m_stopping)
+            {
+                break;
+            }
+            // Повторна спроба після паузи, щоб не навантажувати диск у циклі
+            m_wakeCondition.wait_for(lock, m_window, [this] { return m_stopping; });
+        }
+    }
+}
+
+} // namespace University
@@ -0,0 +1,95 @@
+/**
+ * @file BackgroundFlusher.h
+ * @brief Заголовний файл для фонового потоку групового збереження змін
+ */
+
+#ifndef BACKGROUNDFLUSHER_H
+#define BACKGROUNDFLUSHER_H
+
+#include <chrono>
+#include <condition_variable>
+#include <cstdint>
+#include <functional>
+#include <mutex>
+#include <thread>
+
+namespace University {
+
+/**
+ * @class BackgroundFlusher
+ * @brief Фоновий потік, що об'єднує багато змін в одне збереження
+ *
+ * Кожна мутація лише отримує порядковий номер. Потік викликає функцію
+ * збереження, коли минає вікно очікування або накопичується задана
+ * кількість змін, після чого всі номери до збереженого стають надійними.
+ */
+class BackgroundFlusher {
+private:
+    std::function<bool()> m_flushCallback;   ///< Функція збереження накопичених змін
+    std::chrono::milliseconds m_window;      ///< Максимальна затримка збереження
+    size_t m_batchSize;                      ///< Кількість змін, що запускає збереження негайно
+
+    std::thread m_thread;                    ///< Фоновий потік
+    std::mutex m_mutex;                      ///< Захищає лічильники та прапори
+    std::condition_variable m_wakeCondition;    ///< Пробудження фонового потоку
+    std::condition_variable m_durableCondition; ///< Сповіщення про завершене збереження
+
+    uint64_t m_requestedSequence;            ///< Номер останньої зареєстрованої зміни
+    uint64_t m_durableSequence;              ///< Номер останньої збереженої зміни
+    uint64_t m_attemptedSequence;            ///< Номер, до якого виконано останню спробу збереження
+    bool m_flushRequested;                   ///< Запит на негайне збереження
+    bool m_stopping;                         ///< Прапор завершення роботи
+
+    /**
+     * @brief Основний цикл фонового потоку
+     */
+    void Run();
+
+public:
+    /**
+     * @brief Конструктор з параметрами, запускає фоновий потік
+     * @param flushCallback Функція збереження (повертає true у разі успіху)
+     * @param window Максимальна затримка між зміною та її збереженням
+     * @param batchSize Кількість змін, після якої збереження виконується негайно
+     */
+    BackgroundFlusher(std::function<bool()> flushCallback,
+                      std::chrono::milliseconds window, size_t batchSize);
+
+    BackgroundFlusher(const BackgroundFlusher&) = delete;
+    BackgroundFlusher& operator=(const BackgroundFlusher&) = delete;
+
+    /**
+     * @brief Деструктор
+     * @details Зберігає залишок змін та зупиняє фоновий потік
+     */
+    ~BackgroundFlusher();
+
+    /**
+     * @brief Реєструє нову зміну
+     * @return Порядковий номер зміни
+     */
+    uint64_t NotifyMutation();
+
+    /**
+     * @brief Примусово зберігає всі зареєстровані зміни та чекає завершення
+     * @return true якщо всі зміни збережено, false якщо збереження не вдалося
+     */
+    bool Flush();
+
+    /**
+     * @brief Чекає, доки зміна з вказаним номером не буде збережена
+     * @param sequence Порядковий номер зміни
+     * @return true якщо зміну збережено, false якщо спроба збереження не вдалася
+     */
+    bool WaitDurable(uint64_t sequence);
+
+    /**
+     * @brief Повертає номер останньої зареєстрованої зміни
+     * @return Порядковий номер
+     */
+    uint64_t GetRequestedSequence();
+};
+
+} // namespace University
+
+#endif // BACKGROUNDFLUSHER_H
@@ -0,0 +1,365 @@
+#include "Csv.h"
+
+#include <algorithm>
+#include <cstring>
+
+#if defined(__AVX2__)
+    #include <immintrin.h>
+    #define CSV_USE_AVX2
+#endif
+#if defined(__SSE2__) || defined(_M_X64) || (defined(_M_IX86_FP) && _M_IX86_FP >= 2)
+    #include <emmintrin.h>
+    #define CSV_USE_SSE2
+#endif
+#if defined(_MSC_VER) && !defined(__clang__)
+    #include <intrin.h>
+#endif
+
+using namespace std;
+
+namespace University {
+
+namespace {
+
+#if defined(CSV_USE_AVX2) || defined(CSV_USE_SSE2)
+unsigned CountTrailingZeros(unsigned mask)
+{
+#if defined(_MSC_VER) && !defined(__clang__)
+    unsigned long index;
+    _BitScanForward(&index, mask);
+    return static_cast<unsigned>(index);
+#else
+    return static_cast<unsigned>(__builtin_ctz(mask));
+#endif
+}
+#endif
+
+/**
+ * @brief Знаходить перший роздільник, лапку або символ кінця рядка
+ * @return Вказівник на знайдений символ або end
+ */
+const char* FindSpecial(const char* cursor, const char* end, char delimiter)
+{
+#ifdef CSV_USE_AVX2
+    const __m256i delimiters = _mm256_set1_epi8(delimiter);
+    const __m256i quotes = _mm256_set1_epi8('"');
+    const __m256i returns = _mm256_set1_epi8('\r');
+    const __m256i newlines = _mm256_set1_epi8('\n');
+    while (end - cursor >= 32)
+    {
+        __m256i chunk = _mm256_loadu_si256(reinterpret_cast<const __m256i*>(cursor));
+        __m256i matches = _mm256_or_si256(
+            _mm256_or_si256(_mm256_cmpeq_epi8(chunk, delimiters), _mm256_cmpeq_epi8(chunk, quotes)),
+            _mm256_or_si256(_mm256_cmpeq_epi8(chunk, returns), _mm256_cmpeq_epi8(chunk, newlines)));
+        unsigned mask = static_cast<unsigned>(_mm256_movemask_epi8(matches));
+        if (mask != 0)
+        {
+            return cursor + CountTrailingZeros(mask);
+        }
+        cursor += 32;
+    }
+#endif
+
+#ifdef CSV_USE_SSE2
+    const __m128i delimiters16 = _mm_set1_epi8(delimiter);
+    const __m128i quotes16 = _mm_set1_epi8('"');
+    const __m128i returns16 = _mm_set1_epi8('\r');
+    const __m128i newlines16 = _mm_set1_epi8('\n');
+    while (end - cursor >= 16)
+    {
+        __m128i chunk = _mm_loadu_si128(reinterpret_cast<const __m128i*>(cursor));
+        __m128i matches = _mm_or_si128(
+            _mm_or_si128(_mm_cmpeq_epi8(chunk, delimiters16), _mm_cmpeq_epi8(chunk, quotes16)),
+            _mm_or_si128(_mm_cmpeq_epi8(chunk, returns16), _mm_cmpeq_epi8(chunk, newlines16)));
+        unsigned mask = static_cast<unsigned>(_mm_movemask_epi8(matches));
+        if (mask != 0)
+        {
+            return cursor + CountTrailingZeros(mask);
+        }
+        cursor += 16;
+    }
+#endif
+
+    while (cursor < end)
+    {
+        char c = *cursor;
+        if (c == delimiter || c == '"' || c == '\r' || c == '\n')
+        {
+            return cursor;
+        }
+        cursor++;
+    }
+    return end;
+}
+
+/**
+ * @brief Знаходить кінець поля без лапок (лапки всередині поля - звичайні символи)
+ */
+const char* FindFieldEnd(const char* cursor, const char* end, char delimiter)
+{
+    for (;;)
+    {
+        cursor = FindSpecial(cursor, end, delimiter);
+        if (cursor == end || *cursor != '"' || delimiter == '"')
+        {
+            return cursor;
+        }
+        cursor++;
+    }
+}
+
+} // namespace
+
+// === CsvReader ===
+
+CsvReader::CsvReader(string_view data, char delimiter)
+    : m_data(data), m_position(0), m_delimiter(delimiter), m_terminated(false)
+{
+}
+
+const char* CsvReader::ReadQuotedField(const char* cursor, const char* end, FieldSpan& span)
+{
+    bool hasView = false;
+
+    // Поле залишається представленням у вихідний буфер, доки воно неперервне;
+    // друга частина (після подвоєних лапок) переносить його в робочий буфер
+    auto append = [&](const char* from, const char* to)
+    {
+        if (span.data == nullptr)
+        {
+            m_scratch.append(from, to);
+        }
+        else if (!hasView)
+        {
+            span.data = from;
+            span.size = static_cast<size_t>(to - from);
+            hasView = true;
+        }
+        else if (from != to)
+        {
+            span.offset = m_scratch.size();
+            m_scratch.append(span.data, span.size);
+            m_scratch.append(from, to);
+            span.data = nullptr;
+        }
+    };
+
+    const char* segment = cursor;
+    for (;;)
+    {
+        const void* found = memchr(cursor, '"', static_cast<size_t>(end - cursor));
+        if (!found)
+        {
+            // Лапки не закрито до кінця даних
+            append(segment, end);
+            cursor = end;
+            break;
+        }
+
+        const char* quote = static_cast<const char*>(found);
+        if (quote + 1 < end && quote[1] == '"')
+        {
+            append(segment, quote + 1);
+            cursor = quote + 2;
+            segment = cursor;
+            continue;
+        }
+
+        append(segment, quote);
+        cursor = quote + 1;
+        break;
+    }
+
+    // Символи між закриваючою лапкою та роздільником зберігаються як є
+    const char* fieldEnd = FindFieldEnd(cursor, end, m_delimiter);
+    append(cursor, fieldEnd);
+
+    if (span.data == nullptr)
+    {
+        span.size = m_scratch.size() - span.offset;
+    }
+    return fieldEnd;
+}
+
+bool CsvReader::Next()
+{
+    const char* begin = m_data.data();
+    const char* end = begin + m_data.size();
+
+    while (m_position < m_data.size())
+    {
+        const char* cursor = begin + m_position;
+
+        if (*cursor == '\n')
+        {
+            m_position++;
+            continue;
+        }
+        if (*cursor == '\r')
+        {
+            m_position += (cursor + 1 < end && cursor[1] == '\n') ? 2 : 1;
+            continue;
+        }
+
+        m_spans.clear();
+        m_fields.clear();
+        m_scratch.clear();
+        m_terminated = false;
+
+        for (;;)
+        {
+            FieldSpan span{cursor, 0, 0};
+            if (cursor < end && *cursor == '"')
+            {
+                cursor = ReadQuotedField(cursor + 1, end, span);
+            }
+            else
+            {
+                const char* fieldEnd = FindFieldEnd(cursor, end, m_delimiter);
+                span.size = static_cast<size_t>(fieldEnd - cursor);
+                cursor = fieldEnd;
+            }
+            m_spans.push_back(span);
+
+            if (cursor == end)
+            {
+                break;
+            }
+            if (*cursor == m_delimiter)
+            {
+                cursor++;
+                continue;
+            }
+
+            // Кінець запису: LF, CRLF або одиночний CR
+            if (*cursor == '\r' && cursor + 1 < end && cursor[1] == '\n')
+            {
+                cursor++;
+            }
+            cursor++;
+            m_terminated = true;
+            break;
+        }
+        m_position = static_cast<size_t>(cursor - begin);
+
+        m_fields.reserve(m_spans.size());
+        for (const auto& span : m_spans)
+        {
+            m_fields.push_back(span.data ? string_view(span.data, span.size)
+                                         : string_view(m_scratch.data() + span.offset, span.size));
+        }
+        return true;
+    }
+    return false;
+}
+
+size_t CsvReader::GetFieldCount() const
+{
+    return m_fields.size();
+}
+
+string_view CsvReader::GetField(size_t index) const
+{
+    return index < m_fields.size() ? m_fields[index] : string_view();
+}
+
+const vector<string_view>& CsvReader::GetFields() const
+{
+    return m_fields;
+}
+
+bool CsvReader::IsTerminated() const
+{
+    return m_terminated;
+}
+
+vector<string_view> CsvReader::SplitIntoChunks(string_view data, size_t maxChunks, size_t minChunkSize)
+{
+    size_t chunkCount = min(maxChunks, data.size() / max<size_t>(minChunkSize, 1));
+    if (chunkCount <= 1)
+    {
+        return {data};
+    }
+
+    vector<string_view> chunks;
+    chunks.reserve(chunkCount);
+    size_t step = data.size() / chunkCount;
+    size_t start = 0;
+    size_t scanned = 0;
+    bool inQuotes = false;
+
+    for (size_t i = 1; i < chunkCount; i++)
+    {
+        size_t target = i * step;
+        if (target <= scanned)
+        {
+            continue;
+        }
+
+        // Парність лапок до орієнтовної межі визначає, чи вона всередині поля
+        size_t quotes = static_cast<size_t>(count(data.begin() + scanned, data.begin() + target, '"'));
+        inQuotes ^= (quotes % 2) != 0;
+
+        size_t position = target;
+        while (position < data.size())
+        {
+            char c = data[position];
+            if (c == '"')
+            {
+                inQuotes = !inQuotes;
+            }
+            else if (c == '\n' && !inQuotes)
+            {
+                break;
+            }
+            position++;
+        }
+
+        if (position >= data.size())
+        {
+            scanned = data.size();
+            break;
+        }
+
+        chunks.push_back(data.substr(start, position + 1 - start));
+        start = position + 1;
+        scanned = start;
+    }
+
+    if (start < data.size())
+    {
+        chunks.push_back(data.substr(start));
+    }
+    return chunks;
+}
+
+// === CsvWriter ===
+
+bool CsvWriter::NeedsQuoting(string_view field, char delimiter)
+{
+    const char special[] = {delimiter, '"', '\r', '\n'};
+    return field.find_first_of(string_view(special, sizeof(special))) != string_view::npos;
+}
+
+void CsvWriter::AppendField(string& line, string_view field, char delimiter)
+{
+    if (!NeedsQuoting(field, delimiter))
+    {
+        line.append(field);
+        return;
+    }
+
+    line += '"';
+    size_t start = 0;
+    size_t quote;
+    while ((quote = field.find('"', start)) != string_view::npos)
+    {
+        line.append(field, start, quote - start + 1);
+        line += '"';
+        start = quote + 1;
+    }
+    line.append(field, start, string_view::npos);
+    line += '"';
+}
+
+} // namespace University
@@ -0,0 +1,129 @@
+/**
+ * @file Csv.h
+ * @brief Заголовний файл для розбору та формування рядків CSV (RFC 4180)
+ */
+
+#ifndef CSV_H
+#define CSV_H
+
+#include <string>
+#include <string_view>
+#include <vector>
+
+namespace University {
+
+/**
+ * @class CsvReader
+ * @brief Послідовно читає записи CSV з буфера
+ *
+ * Підтримує поля в лапках (з роздільниками, переносами рядків та
+ * подвоєними лапками всередині), закінчення рядків LF та CRLF і довільний
+ * односимвольний роздільник. Пошук роздільників, лапок і переносів рядків
+ * виконується по 32 (AVX2) або 16 (SSE2) байтів за раз, якщо компілятор
+ * дозволяє ці інструкції, інакше - посимвольно.
+ *
+ * Поля повертаються як std::string_view у вихідний буфер; лише поля з
+ * подвоєними лапками копіюються в робочий буфер поточного запису.
+ * Представлення дійсні до наступного виклику Next(). Порожні рядки
+ * пропускаються.
+ */
+class CsvReader {
+private:
+    /**
+     * @struct FieldSpan
+     * @brief Розташування поля: у вихідному буфері або в робочому буфері запису
+     */
+    struct FieldSpan {
+        const char* data;   ///< Початок поля у вихідному буфері (nullptr якщо поле в робочому буфері)
+        size_t offset;      ///< Зміщення поля в робочому буфері
+        size_t size;        ///< Довжина поля
+    };
+
+    std::string_view m_data;               ///< Вхідні дані
+    size_t m_position;                     ///< Позиція початку наступного запису
+    char m_delimiter;                      ///< Роздільник полів
+    bool m_terminated;                     ///< Чи завершився поточний запис переносом рядка
+    std::vector<FieldSpan> m_spans;        ///< Розташування полів поточного запису
+    std::vector<std::string_view> m_fields;///< Поля поточного запису
+    std::string m_scratch;                 ///< Робочий буфер для полів з екрануванням
+
+    const char* ReadQuotedField(const char* cursor, const char* end, FieldSpan& span);
+
+public:
+    /**
+     * @brief Конструктор з параметрами
+     * @param data Дані у форматі CSV
+     * @param delimiter Роздільник полів
+     */
+    explicit CsvReader(std::string_view data, char delimiter = ',');
+
+    /**
+     * @brief Переходить до наступного запису
+     * @return true якщо запис прочитано, false якщо дані закінчились
+     */
+    bool Next();
+
+    /**
+     * @brief Повертає кількість полів поточного запису
+     */
+    size_t GetFieldCount() const;
+
+    /**
+     * @brief Повертає поле поточного запису
+     * @param index Номер поля
+     * @return Представлення вмісту поля без лапок
+     */
+    std::string_view GetField(size_t index) const;
+
+    /**
+     * @brief Повертає всі поля поточного запису
+     */
+    const std::vector<std::string_view>& GetFields() const;
+
+    /**
+     * @brief Перевіряє, чи завершився поточний запис переносом рядка
+     * @details Незавершений запис у кінці файлу може бути недописаним.
+     * @return true якщо після запису є перенос рядка
+     */
+    bool IsTerminated() const;
+
+    /**
+     * @brief Розбиває дані на частини, що починаються з початку запису
+     * @details Межа частини ставиться лише на перенос рядка поза лапками
+     * (парна кількість лапок від початку даних), тож кожну частину можна
+     * розбирати окремим CsvReader незалежно від інших.
+     * @param data Дані у форматі CSV
+     * @param maxChunks Максимальна кількість частин
+     * @param minChunkSize Мінімальний розмір частини в байтах
+     * @return Частини в порядку розташування у файлі
+     */
+    static std::vector<std::string_view> SplitIntoChunks(std::string_view data, size_t maxChunks,
+                                                         size_t minChunkSize);
+};
+
+/**
+ * @class CsvWriter
+ * @brief Формує поля CSV з екрануванням за RFC 4180
+ */
+class CsvWriter {
+public:
+    /**
+     * @brief Перевіряє, чи потребує поле лапок
+     * @param field Вміст поля
+     * @param delimiter Роздільник полів
+     * @return true якщо поле містить роздільник, лапки або перенос рядка
+     */
+    static bool NeedsQuoting(std::string_view field, char delimiter = ',');
+
+    /**
+     * @brief Дописує поле до рядка, беручи його в лапки за потреби
+     * @param line Рядок, що формується
+     * @param field Вміст поля
+     * @param delimiter Роздільник полів
+     */
+    static void AppendField(std::string& line, std::string_view field, char delimiter = ',');
+};
+
+} // namespace University
+
+#endif // CSV_H
@@ -2,695 +2,2895 @@
 
 #include <iostream>
 #include <fstream>
-#include <sstream>
 #include <algorithm>
+#include <cassert>
 #include <cctype>
+#include <charconv>
+#include <future>
+#include <numeric>
+#include <stdexcept>
+#include <functional>
+#include <thread>
+#include <tuple>
 
 #include "FileConstants.h"
+#include "FileUtils.h"
+#include "MappedFile.h"
+#include "Csv.h"
+#include "TextUtils.h"
+#include "FuzzyMatcher.h"
 
 using namespace std;
 
 namespace University {
 
-DatabaseManager::DatabaseManager()
-{
-    LoadFromFile(FileConstants::STUDENTS_FILE,
-                 FileConstants::TEACHERS_FILE,
-                 FileConstants::SUBJECTS_FILE);
-}
+namespace {
 
-DatabaseManager::DatabaseManager(const string& studentsFile,
-                                 const string& teachersFile,
-                                 const string& subjectsFile)
-{
-    LoadFromFile(studentsFile, teachersFile, subjectsFile);
-}
+// Менші файли розбираються в одному потоці: створення потоків коштує більше
+const size_t PARALLEL_PARSE_CHUNK_SIZE = 1 << 20;
+
+// Менші колекції переглядаються в одному потоці: розподіл роботи коштує більше
+const size_t PARALLEL_SCAN_MIN_RECORDS = 1 << 15;
 
-DatabaseManager::DatabaseManager(const DatabaseManager& other)
-    : m_students(other.m_students),
-      m_teachers(other.m_teachers),
-      m_subjects(other.m_subjects)
+/**
+ * @brief Читає номер символу з тіла знімка
+ * @param symbols Символи процесу для номерів таблиці цього знімка (SymbolTable::ReadFrom)
+ * @return false якщо номера немає в таблиці знімка (знімок пошкоджено)
+ */
+bool ReadSymbol(SnapshotReader& reader, const vector<Symbol>& symbols, Symbol& symbol)
 {
+    uint32_t id = reader.ReadUInt32();
+    if (id >= symbols.size())
+    {
+        return false;
+    }
+    symbol = symbols[id];
+    return true;
 }
 
-DatabaseManager::DatabaseManager(DatabaseManager&& other) noexcept
-    : m_students(std::move(other.m_students)),
-      m_teachers(std::move(other.m_teachers)),
-      m_subjects(std::move(other.m_subjects))
+/**
+ * @brief Перетворює числове поле без створення тимчасового рядка
+ * @throw std::invalid_argument Якщо поле не є числом
+ */
+int ParseInt(string_view text)
 {
+    while (!text.empty() && isspace(static_cast<unsigned char>(text.front())))
+    {
+        text.remove_prefix(1);
+    }
+    if (!text.empty() && text.front() == '+')
+    {
+        text.remove_prefix(1);
+    }
+
+    int value = 0;
+    auto result = from_chars(text.data(), text.data() + text.size(), value);
+    if (result.ec != errc() || result.ptr == text.data())
+    {
+        throw invalid_argument("Некоректне число: " + string(text));
+    }
+    return value;
 }
 
-DatabaseManager::~DatabaseManager()
+/**
+ * @brief Оцінює кількість записів за кількістю рядків
+ */
+size_t CountLines(string_view data)
 {
+    return static_cast<size_t>(count(data.begin(), data.end(), '\n')) + 1;
 }
 
-bool DatabaseManager::AddStudent(const Student& student)
+/**
+ * @brief Виконує завдання з номерами [0, count) паралельно
+ * @details Завдання виконуються потоками пулу, а без пулу - окремими потоками.
+ * Одне завдання виконується в поточному потоці без створення нових.
+ */
+template <typename Task>
+void RunParallel(ThreadPool* pool, size_t count, Task task)
 {
-    if (!student.isValid())
+    if (pool)
     {
-        throw invalid_argument("Некоректні дані студента");
+        pool->ParallelFor(count, task);
+        return;
     }
-    if (GetStudent(student.getStudentID()) != nullptr)
+    if (count == 1)
     {
-        throw invalid_argument("Студент з таким ID вже існує: " + student.getStudentID());
+        task(0);
+        return;
     }
-    m_students.push_back(student);
-    SaveToFile(FileConstants::STUDENTS_FILE,
-               FileConstants::TEACHERS_FILE,
-               FileConstants::SUBJECTS_FILE);
-    return true;
-}
 
-bool DatabaseManager::AddTeacher(const Teacher& teacher)
-{
-    if (!teacher.isValid())
+    vector<thread> workers;
+    workers.reserve(count);
+    for (size_t i = 0; i < count; i++)
     {
-        throw invalid_argument("Некоректні дані викладача");
+        workers.emplace_back(task, i);
     }
-    if (GetTeacher(teacher.getTeacherID()) != nullptr)
+    for (auto& worker : workers)
     {
-        throw invalid_argument("Викладач з таким ID вже існує: " + teacher.getTeacherID());
+        worker.join();
     }
-    m_teachers.push_back(teacher);
-    SaveToFile(FileConstants::STUDENTS_FILE,
-               FileConstants::TEACHERS_FILE,
-               FileConstants::SUBJECTS_FILE);
-    return true;
 }
 
-bool DatabaseManager::AddSubject(const Subject& subject)
+using IdIndex = unordered_map<string, size_t>;
+
+const size_t NOT_FOUND = static_cast<size_t>(-1);
+
+/**
+ * @brief Заповнює індекс ID -> позиція; при дублікатах залишається перший запис
+ */
+template <typename Record>
+void RebuildIndex(const RecordTable<Record>& records, IdIndex& index)
 {
-    if (!subject.isValid())
-    {
-        throw invalid_argument("Некоректні дані предмета");
-    }
-    if (GetSubject(subject.getSubjectId()) != nullptr)
+    index.clear();
+    index.reserve(records.Size());
+    for (size_t i = 0; i < records.Size(); i++)
     {
-        throw invalid_argument("Предмет з таким ID вже існує: " + subject.getSubjectId());
+        index.emplace(records.GetId(i), i);
     }
-    m_subjects.push_back(subject);
-    SaveToFile(FileConstants::STUDENTS_FILE,
-               FileConstants::TEACHERS_FILE,
-               FileConstants::SUBJECTS_FILE);
-    return true;
 }
 
-bool DatabaseManager::EditStudent(const string& studentId, const Student& newData)
+/**
+ * @brief Результат розбору однієї частини файлу
+ */
+template <typename Record>
+struct ParsedChunk {
+    RecordTable<Record> records;  ///< Коректні записи в порядку файлу
+    vector<string> errors;        ///< Повідомлення про помилки парсингу
+    bool complete = true;         ///< Чи завершився останній запис частини переносом рядка
+};
+
+/**
+ * @brief Розбирає CSV-дані паралельно та об'єднує результат у порядку файлу
+ *
+ * Дані ділляться на частини по межах записів, кожна частина розбирається
+ * та перевіряється (конструктори сутностей) окремим потоком у власну плоску
+ * таблицю, тож під час розбору існує лише по одному об'єкту запису на потік.
+ * Під час об'єднання записи з ID, що вже є в індексі, пропускаються, а решта
+ * переноситься в таблицю; таблиця частини звільняється одразу після неї.
+ *
+ * @param pool Пул потоків (nullptr - окремі потоки)
+ * @param data Вміст CSV-файлу
+ * @param target Колекція, що заповнюється
+ * @param index Індекс ID колекції, що заповнюється разом з нею
+ * @param parse Функція перетворення полів у запис (може кидати винятки)
+ * @param entityName Назва сутності для повідомлень
+ */
+template <typename Record, typename Parser>
+void LoadRecordsParallel(ThreadPool* pool, string_view data, RecordTable<Record>& target, IdIndex& index,
+                         Parser parse, const string& entityName)
 {
-    if (!newData.isValid())
-    {
-        throw invalid_argument("Некоректні нові дані студента");
-    }
-    for (auto& student : m_students)
+    size_t threadCount = pool ? pool->GetThreadCount() + 1 : max(1u, thread::hardware_concurrency());
+    vector<string_view> chunks = CsvReader::SplitIntoChunks(data, threadCount, PARALLEL_PARSE_CHUNK_SIZE);
+    vector<ParsedChunk<Record>> parsed(chunks.size());
+
+    auto parseChunk = [&parse, &entityName](string_view chunk, ParsedChunk<Record>& result)
     {
-        if (student.getStudentID() == studentId)
+        result.records.Reserve(CountLines(chunk));
+
+        CsvReader reader(chunk);
+        Record record;
+        while (reader.Next())
         {
-            student = newData;
-            SaveToFile(FileConstants::STUDENTS_FILE,
-                       FileConstants::TEACHERS_FILE,
-                       FileConstants::SUBJECTS_FILE);
-            return true;
+            result.complete = reader.IsTerminated();
+            try
+            {
+                if (parse(reader.GetFields(), record))
+                {
+                    result.records.Append(record);
+                }
+            }
+            catch (const exception& e)
+            {
+                result.errors.push_back("Помилка парсингу даних " + entityName + ": " + e.what());
+            }
         }
-    }
-    return false;
-}
-
-bool DatabaseManager::EditTeacher(const string& teacherId, const Teacher& newData)
-{
-    if (!newData.isValid())
+    };
+    RunParallel(pool, chunks.size(), [&chunks, &parsed, &parseChunk](size_t index)
     {
-        throw invalid_argument("Некоректні нові дані викладача");
-    }
-    for (auto& teacher : m_teachers)
+        parseChunk(chunks[index], parsed[index]);
+    });
+
+    // Межі частин обираються за парністю лапок, тож зайва лапка в полі без лапок
+    // може зсунути межу всередину запису. Тоді запис перед межею не завершений
+    // (перша частина починається з початку файлу, тож помилку видно на першій
+    // хибній межі), і файл розбирається послідовно
+    for (size_t i = 0; i + 1 < parsed.size(); i++)
     {
-        if (teacher.getTeacherID() == teacherId)
+        if (!parsed[i].complete)
         {
-            teacher = newData;
-            SaveToFile(FileConstants::STUDENTS_FILE,
-                       FileConstants::TEACHERS_FILE,
-                       FileConstants::SUBJECTS_FILE);
-            return true;
+            parsed.assign(1, ParsedChunk<Record>());
+            parseChunk(data, parsed[0]);
+            break;
         }
     }
-    return false;
-}
 
-bool DatabaseManager::EditSubject(const string& subjectId, const Subject& newData)
-{
-    if (!newData.isValid())
+    size_t total = 0;
+    for (const auto& chunk : parsed)
     {
-        throw invalid_argument("Некоректні нові дані предмета");
+        total += chunk.records.Size();
     }
-    for (auto& subject : m_subjects)
+
+    target.Clear();
+    target.Reserve(total);
+    index.clear();
+    index.reserve(total);
+
+    for (auto& chunk : parsed)
     {
-        if (subject.getSubjectId() == subjectId)
+        for (const auto& error : chunk.errors)
         {
-            subject = newData;
-            SaveToFile(FileConstants::STUDENTS_FILE,
-                       FileConstants::TEACHERS_FILE,
-                       FileConstants::SUBJECTS_FILE);
-            return true;
+            cerr << error + "\n";
+        }
+        for (size_t i = 0; i < chunk.records.Size(); i++)
+        {
+            string_view id = chunk.records.GetId(i);
+            if (index.emplace(id, target.Size()).second)
+            {
+                target.Append(chunk.records.Get(i));
+            }
+            else
+            {
+                cerr << "Дублікат ID " + entityName + ", запис пропущено: " + string(id) + "\n";
+            }
         }
+        chunk.records = RecordTable<Record>();
     }
-    return false;
 }
 
-bool DatabaseManager::DeleteStudent(const string& studentId)
+/**
+ * @brief Шукає позицію запису за ID
+ * @details Колекції змінюються лише через менеджер, тож індекс завжди відповідає
+ * колекції і пошук - одне звернення до хеш-таблиці.
+ */
+size_t FindIndexed(const IdIndex& index, const string& id)
 {
-    auto it = remove_if(m_students.begin(), m_students.end(),
-        [&](const Student& s) { return s.getStudentID() == studentId; });
-    if (it != m_students.end())
-    {
-        m_students.erase(it, m_students.end());
-        SaveToFile(FileConstants::STUDENTS_FILE,
-                   FileConstants::TEACHERS_FILE,
-                   FileConstants::SUBJECTS_FILE);
-        return true;
-    }
-    return false;
+    auto it = index.find(id);
+    return it != index.end() ? it->second : NOT_FOUND;
 }
 
-bool DatabaseManager::DeleteTeacher(const string& teacherId)
+/**
+ * @brief Виконує дію для кожного похідного індексу колекції
+ */
+template <typename Action, typename... Secondary>
+void ForEachSecondary(const tuple<Secondary&...>& secondary, Action action)
 {
-    auto it = remove_if(m_teachers.begin(), m_teachers.end(),
-        [&](const Teacher& t) { return t.getTeacherID() == teacherId; });
-    if (it != m_teachers.end())
-    {
-        m_teachers.erase(it, m_teachers.end());
-        SaveToFile(FileConstants::STUDENTS_FILE,
-                   FileConstants::TEACHERS_FILE,
-                   FileConstants::SUBJECTS_FILE);
-        return true;
-    }
-    return false;
+    apply([&action](auto&... index) { (action(index), ...); }, secondary);
 }
 
-bool DatabaseManager::DeleteSubject(const string& subjectId)
+/**
+ * @brief Заповнює похідні індекси за поточними дескрипторами записів
+ */
+template <typename Record, typename... Secondary>
+void RebuildSecondary(const RecordTable<Record>& records, const SlotMap<Record>& slots,
+                      const tuple<Secondary&...>& secondary)
 {
-    auto it = remove_if(m_subjects.begin(), m_subjects.end(),
-        [&](const Subject& s) { return s.getSubjectId() == subjectId; });
-    if (it != m_subjects.end())
+    ForEachSecondary(secondary, [](auto& index) { index.Clear(); });
+    for (size_t i = 0; i < records.Size(); i++)
     {
-        m_subjects.erase(it, m_subjects.end());
-        SaveToFile(FileConstants::STUDENTS_FILE,
-                   FileConstants::TEACHERS_FILE,
-                   FileConstants::SUBJECTS_FILE);
-        return true;
+        Handle<Record> handle = slots.HandleAt(i);
+        Record record = records.Get(i);
+        ForEachSecondary(secondary, [&](auto& index) { index.Insert(record, handle); });
     }
-    return false;
 }
 
-vector<Student> DatabaseManager::GetAllStudents() const
+template <typename Record, typename... Secondary>
+void AppendIndexed(RecordTable<Record>& records, IdIndex& index, SlotMap<Record>& slots,
+                   const Record& record, const tuple<Secondary&...>& secondary)
 {
-    return m_students;
+    assert(slots.Size() == records.Size());
+    records.Append(record);
+    index[RowLayout<Record>::IdOf(record)] = records.Size() - 1;
+    Handle<Record> handle = slots.Insert();
+    ForEachSecondary(secondary, [&](auto& index) { index.Insert(record, handle); });
 }
 
-vector<Teacher> DatabaseManager::GetAllTeachers() const
+/**
+ * @brief Замінює запис на позиції, оновлюючи індекс при зміні ID
+ * @details Слот запису не змінюється, тож його дескриптор залишається дійсним.
+ * Похідні індекси вилучають запис до заміни рядка (впорядкований індекс
+ * читає ключі з таблиці) і додають його знову після неї.
+ */
+template <typename Record, typename... Secondary>
+void ReplaceIndexed(RecordTable<Record>& records, IdIndex& index, SlotMap<Record>& slots,
+                    size_t position, const Record& record, const tuple<Secondary&...>& secondary)
 {
-    return m_teachers;
+    assert(slots.Size() == records.Size());
+    Record previous = records.Get(position);
+    Handle<Record> handle = slots.HandleAt(position);
+    ForEachSecondary(secondary, [&](auto& index) { index.Erase(previous, handle); });
+    records.Set(position, record);
+    ForEachSecondary(secondary, [&](auto& index) { index.Insert(record, handle); });
+    const string& oldId = RowLayout<Record>::IdOf(previous);
+    const string& newId = RowLayout<Record>::IdOf(record);
+    if (newId != oldId)
+    {
+        index.erase(oldId);
+        index[newId] = position;
+    }
 }
 
-vector<Subject> DatabaseManager::GetAllSubjects() const
+/**
+ * @brief Видаляє запис за O(1): на його позицію переноситься останній запис
+ * @details Змінюється позиція лише перенесеного запису, тож оновлюється
+ * один елемент індексу ID; дескриптори залишаються дійсними.
+ */
+template <typename Record, typename... Secondary>
+void EraseIndexed(RecordTable<Record>& records, IdIndex& index, SlotMap<Record>& slots,
+                  size_t position, const tuple<Secondary&...>& secondary)
 {
-    return m_subjects;
+    assert(slots.Size() == records.Size());
+    Record erased = records.Get(position);
+    index.erase(RowLayout<Record>::IdOf(erased));
+    Handle<Record> handle = slots.HandleAt(position);
+    ForEachSecondary(secondary, [&](auto& index) { index.Erase(erased, handle); });
+    records.Erase(position);
+    if (position < records.Size())
+    {
+        index[string(records.GetId(position))] = position;
+    }
+    slots.Erase(position);
 }
 
-Student* DatabaseManager::GetStudent(const string& studentId)
+/**
+ * @brief Відтворює з журналу додавання чи редагування запису
+ * @details Журнал може відтворюватися поверх CSV, куди частину його змін уже
+ * записано, тож операція, результат якої вже є в колекції, не повторюється:
+ * додавання наявного ID пропускається, а редагування зі зміною ID, після
+ * якого старого ID вже немає, а новий є, вважається застосованим. Якщо ж
+ * рядок зі старим ID повторно з'явився (його знову додав попередній запис
+ * журналу), а новий ID вже є, застарілий рядок видаляється.
+ * @param id ID запису, до якого відноситься операція (для редагування - старий ID)
+ */
+template <typename Record, typename... Secondary>
+void ReplayUpsert(RecordTable<Record>& records, IdIndex& index, SlotMap<Record>& slots, JournalOperation operation,
+                  const string& id, const Record& record, const tuple<Secondary&...>& secondary)
 {
-    for (auto& student : m_students)
+    const string& newId = RowLayout<Record>::IdOf(record);
+    size_t position = FindIndexed(index, id);
+    size_t existing = newId == id ? position : FindIndexed(index, newId);
+    if (operation == JournalOperation::Add && existing != NOT_FOUND)
+    {
+        return;
+    }
+    if (position == NOT_FOUND)
     {
-        if (student.getStudentID() == studentId)
+        if (existing == NOT_FOUND)
         {
-            return &student;
+            AppendIndexed(records, index, slots, record, secondary);
         }
+        return;
+    }
+    if (existing != NOT_FOUND && existing != position)
+    {
+        EraseIndexed(records, index, slots, position, secondary);
+        position = FindIndexed(index, newId);
     }
-    return nullptr;
+    ReplaceIndexed(records, index, slots, position, record, secondary);
 }
 
-Teacher* DatabaseManager::GetTeacher(const string& teacherId)
+/**
+ * @brief Сортує колекцію за ключем, переносячи дескриптори записів на нові позиції
+ * @details Ключі обчислюються один раз для кожного запису, а переставляються лише рядки таблиці.
+ */
+template <typename Record>
+void SortIndexed(RecordTable<Record>& records, IdIndex& index, SlotMap<Record>& slots,
+                 string (*keyOf)(const Record&), bool ascending)
 {
-    for (auto& teacher : m_teachers)
+    assert(slots.Size() == records.Size());
+
+    vector<string> keys;
+    keys.reserve(records.Size());
+    for (size_t i = 0; i < records.Size(); i++)
     {
-        if (teacher.getTeacherID() == teacherId)
-        {
-            return &teacher;
-        }
+        keys.push_back(keyOf(records.Get(i)));
     }
-    return nullptr;
+    vector<size_t> order(records.Size());
+    iota(order.begin(), order.end(), 0);
+    sort(order.begin(), order.end(), [&keys, ascending](size_t a, size_t b)
+        { return ascending ? keys[a] < keys[b] : keys[a] > keys[b]; });
+
+    records.Permute(order);
+    slots.Permute(order);
+    RebuildIndex(records, index);
 }
 
-Subject* DatabaseManager::GetSubject(const string& subjectId)
+/**
+ * @brief Повертає представлення записів за дескрипторами в порядку колекції
+ */
+template <typename Record>
+RecordView<Record> CollectInOrder(const RecordTable<Record>& records, const SlotMap<Record>& slots,
+                                  const vector<Handle<Record>>& handles)
 {
-    for (auto& subject : m_subjects)
+    assert(slots.Size() == records.Size());
+    vector<size_t> positions;
+    positions.reserve(handles.size());
+    for (const auto& handle : handles)
     {
-        if (subject.getSubjectId() == subjectId)
-        {
-            return &subject;
-        }
+        positions.push_back(slots.Resolve(handle));
     }
-    return nullptr;
+    sort(positions.begin(), positions.end());
+    return RecordView<Record>(records, std::move(positions));
 }
 
-vector<Student> DatabaseManager::SearchStudentsByName(const string& name) const
+/**
+ * @brief Залишає перші count позицій у заданому порядку
+ * @details Для count, меншого за кількість позицій, використовується
+ * часткове сортування: O(n log count) замість O(n log n). Записи, рівні
+ * за порядком, лишаються в порядку колекції.
+ */
+template <typename Compare>
+void KeepFirstInOrder(vector<size_t>& positions, size_t count, Compare compare)
 {
-    vector<Student> result;
-    string lowerName = name;
-    transform(lowerName.begin(), lowerName.end(), lowerName.begin(), ::tolower);
-
-    for (const auto& student : m_students)
+    auto ordered = [&compare](size_t a, size_t b)
     {
-        string fullName = student.getFullName();
-        transform(fullName.begin(), fullName.end(), fullName.begin(), ::tolower);
-        if (fullName.find(lowerName) != string::npos)
+        if (compare(a, b))
         {
-            result.push_back(student);
+            return true;
         }
+        return !compare(b, a) && a < b;
+    };
+    if (count < positions.size())
+    {
+        partial_sort(positions.begin(), positions.begin() + static_cast<ptrdiff_t>(count),
+                     positions.end(), ordered);
+        positions.resize(count);
+    }
+    else
+    {
+        sort(positions.begin(), positions.end(), ordered);
     }
-    return result;
 }
 
-vector<Teacher> DatabaseManager::SearchTeachersByName(const string& name) const
+/**
+ * @brief Повертає перші count записів колекції в заданому порядку
+ * @param less Порівняння записів за їхніми позиціями
+ */
+template <typename Record, typename Less>
+RecordView<Record> TopByOrder(const RecordTable<Record>& records, size_t count, Less less)
 {
-    vector<Teacher> result;
-    string lowerName = name;
-    transform(lowerName.begin(), lowerName.end(), lowerName.begin(), ::tolower);
+    vector<size_t> positions(records.Size());
+    iota(positions.begin(), positions.end(), 0);
+    KeepFirstInOrder(positions, count, less);
+    return RecordView<Record>(records, std::move(positions));
+}
 
-    for (const auto& teacher : m_teachers)
+/**
+ * @brief Повертає перші count записів у порядку впорядкованого індексу
+ * @details Індекс обходиться лише до count-го запису.
+ */
+template <typename Record>
+RecordView<Record> TopOrdered(const RecordTable<Record>& records, const SlotMap<Record>& slots,
+                              const OrderedIndex<Record>& order, bool ascending, size_t count)
+{
+    assert(slots.Size() == records.Size());
+    if (count == 0)
     {
-        string fullName = teacher.getFullName();
-        transform(fullName.begin(), fullName.end(), fullName.begin(), ::tolower);
-        if (fullName.find(lowerName) != string::npos)
-        {
-            result.push_back(teacher);
-        }
+        return RecordView<Record>();
     }
-    return result;
+
+    vector<size_t> positions;
+    positions.reserve(min(count, records.Size()));
+    order.ForEach(ascending, [&](Handle<Record> handle)
+    {
+        positions.push_back(slots.Resolve(handle));
+        return positions.size() < count;
+    });
+    return RecordView<Record>(records, std::move(positions));
 }
 
-vector<Subject> DatabaseManager::SearchSubjectsByName(const string& name) const
+/**
+ * @brief Обходить записи в порядку впорядкованого індексу
+ * @details Сама колекція не змінюється.
+ */
+template <typename Record, typename Visitor>
+void VisitOrdered(const RecordTable<Record>& records, const SlotMap<Record>& slots,
+                  const OrderedIndex<Record>& order, bool ascending, Visitor visit)
 {
-    vector<Subject> result;
-    string lowerName = name;
-    transform(lowerName.begin(), lowerName.end(), lowerName.begin(), ::tolower);
+    assert(slots.Size() == records.Size());
+    order.ForEach(ascending, [&](Handle<Record> handle)
+    {
+        visit(records.Get(slots.Resolve(handle)));
+    });
+}
 
-    for (const auto& subject : m_subjects)
+/**
+ * @brief Повертає номери [0, count), що задовольняють умову, у порядку зростання
+ * @details Застосовується лише в RunQuery до умов, яких не покриває жоден
+ * індекс: ними перевіряються кандидати з індексу або вся колекція. Великі діапазони діляться на частини, що перевіряються потоками
+ * пулу з окремим буфером результатів; буфери об'єднуються в порядку частин.
+ * Без пулу або для невеликих діапазонів перевірка виконується послідовно.
+ */
+template <typename Predicate>
+vector<size_t> ScanMatching(ThreadPool* pool, size_t count, Predicate matches)
+{
+    vector<size_t> result;
+    if (!pool || pool->GetThreadCount() == 0 || count < PARALLEL_SCAN_MIN_RECORDS)
     {
-        string subjectName = subject.getSubjectName();
-        transform(subjectName.begin(), subjectName.end(), subjectName.begin(), ::tolower);
-        if (subjectName.find(lowerName) != string::npos)
+        for (size_t i = 0; i < count; i++)
         {
-            result.push_back(subject);
+            if (matches(i))
+            {
+                result.push_back(i);
+            }
         }
+        return result;
     }
-    return result;
-}
-
-vector<Student> DatabaseManager::FilterStudentsByProgram(const string& program) const
-{
-    vector<Student> result;
-    string lowerProgram = program;
-    transform(lowerProgram.begin(), lowerProgram.end(), lowerProgram.begin(), ::tolower);
 
-    for (const auto& student : m_students)
+    // Поточний потік теж виконує частину роботи
+    size_t partCount = pool->GetThreadCount() + 1;
+    size_t partSize = (count + partCount - 1) / partCount;
+    vector<vector<size_t>> parts(partCount);
+    pool->ParallelFor(partCount, [&parts, &matches, partSize, count](size_t part)
     {
-        string studentProgram = student.getEducationalProgram();
-        transform(studentProgram.begin(), studentProgram.end(), studentProgram.begin(), ::tolower);
-        if (studentProgram.find(lowerProgram) != string::npos)
+        size_t end = min(count, (part + 1) * partSize);
+        for (size_t i = part * partSize; i < end; i++)
         {
-            result.push_back(student);
+            if (matches(i))
+            {
+                parts[part].push_back(i);
+            }
         }
+    });
+
+    size_t total = 0;
+    for (const auto& part : parts)
+    {
+        total += part.size();
+    }
+    result.reserve(total);
+    for (const auto& part : parts)
+    {
+        result.insert(result.end(), part.begin(), part.end());
     }
     return result;
 }
 
-vector<Teacher> DatabaseManager::FilterTeachersByDepartment(const string& department) const
+/**
+ * @brief Знаходить записи, нормалізована назва яких схожа на запит
+ * @details Кандидати відбираються за довжиною та спільними триграмами.
+ * Результат впорядковано за відстанню редагування, рівні - за порядком колекції.
+ */
+template <typename Record>
+RecordView<Record> FuzzySearch(const RecordTable<Record>& records, const SlotMap<Record>& slots,
+                               const TrigramIndex<Record>& nameIndex, const string& query, size_t maxDistance)
 {
-    vector<Teacher> result;
-    string lowerDepartment = department;
-    transform(lowerDepartment.begin(), lowerDepartment.end(), lowerDepartment.begin(), ::tolower);
-
-    for (const auto& teacher : m_teachers)
+    assert(slots.Size() == records.Size());
+    string folded = TextUtils::FoldCase(query);
+    FuzzyMatcher matcher(folded);
+    // Якщо дозволити змінити більше третини запиту, схожим стає майже все
+    maxDistance = min(maxDistance, matcher.GetLength() / 3);
+
+    vector<pair<size_t, size_t>> ranked;
+    auto check = [&matcher, &ranked, maxDistance](size_t position, string_view text)
     {
-        string teacherDepartment = teacher.getDepartment();
-        transform(teacherDepartment.begin(), teacherDepartment.end(), teacherDepartment.begin(), ::tolower);
-        if (teacherDepartment.find(lowerDepartment) != string::npos)
+        // Кожен символ займає щонайменше один байт
+        if (text.size() + maxDistance < matcher.GetLength())
+        {
+            return;
+        }
+        size_t distance = matcher.Distance(text);
+        if (distance <= maxDistance)
         {
-            result.push_back(teacher);
+            ranked.emplace_back(distance, position);
         }
+    };
+
+    nameIndex.ForEachSharing(folded, maxDistance * (matcher.GetMaxCharBytes() + 2),
+        [&slots, &check](Handle<Record> handle, const string& text)
+        {
+            check(slots.Resolve(handle), text);
+        });
+
+    sort(ranked.begin(), ranked.end());
+    vector<size_t> positions;
+    positions.reserve(ranked.size());
+    for (const auto& match : ranked)
+    {
+        positions.push_back(match.second);
     }
-    return result;
+    return RecordView<Record>(records, std::move(positions));
 }
 
-vector<Subject> DatabaseManager::FilterSubjectsBySemester(int semester) const
+// === СКЛАДЕНІ ЗАПИТИ ===
+
+/**
+ * @struct AccessPath
+ * @brief Спосіб отримати кандидатів для умови запиту через індекс
+ */
+struct AccessPath {
+    size_t estimate;                    ///< Очікувана кількість кандидатів
+    function<vector<size_t>()> fetch;   ///< Позиції кандидатів (надмножина результату)
+};
+
+/**
+ * @brief Перетворює дескриптори на позиції, пропускаючи недійсні
+ */
+template <typename Record>
+vector<size_t> ResolvePositions(const SlotMap<Record>& slots, const vector<Handle<Record>>& handles)
 {
-    vector<Subject> result;
-    for (const auto& subject : m_subjects)
+    vector<size_t> positions;
+    positions.reserve(handles.size());
+    for (const auto& handle : handles)
     {
-        if (subject.getSemester() == semester)
+        size_t position = slots.Resolve(handle);
+        if (position != SlotMap<Record>::NOT_FOUND)
         {
-            result.push_back(subject);
+            positions.push_back(position);
         }
     }
-    return result;
+    return positions;
 }
 
-void DatabaseManager::SortStudentsByName(bool ascending)
+/**
+ * @brief Перевіряє текстове значення в нижньому регістрі
+ * @param value Значення поля в нижньому регістрі
+ * @param match Спосіб порівняння
+ * @param folded Значення умови в нижньому регістрі
+ */
+bool MatchesFolded(string_view value, Match match, const string& folded)
 {
-    sort(m_students.begin(), m_students.end(),
-        [ascending](const Student& a, const Student& b)
-        {
-            return ascending ? a.getFullName() < b.getFullName()
-                            : a.getFullName() > b.getFullName();
-        });
+    switch (match)
+    {
+        case Match::Equals:
+            return value == folded;
+        case Match::Contains:
+            return value.find(folded) != string_view::npos;
+        case Match::StartsWith:
+            return value.compare(0, folded.size(), folded) == 0;
+        case Match::Less:
+            return value < folded;
+        case Match::Greater:
+            return value > folded;
+    }
+    return false;
 }
 
-void DatabaseManager::SortTeachersByName(bool ascending)
+/**
+ * @brief Перевіряє текстове значення поля (без урахування регістру), згортаючи його
+ * @details Поля записів зберігаються разом із варіантом у нижньому регістрі
+ * (MatchesFolded), тож згортання потрібне лише для значень символів.
+ * @param value Значення поля
+ * @param match Спосіб порівняння
+ * @param folded Значення умови в нижньому регістрі
+ */
+bool MatchesText(string_view value, Match match, const string& folded)
 {
-    sort(m_teachers.begin(), m_teachers.end(),
-        [ascending](const Teacher& a, const Teacher& b)
-        {
-            return ascending ? a.getFullName() < b.getFullName()
-                            : a.getFullName() > b.getFullName();
-        });
+    // Буфер кожного потоку перевикористовується: перевірка не виділяє пам'ять
+    thread_local string foldedValue;
+    foldedValue.clear();
+    TextUtils::AppendFolded(foldedValue, value);
+    return MatchesFolded(foldedValue, match, folded);
 }
 
-void DatabaseManager::SortSubjectsByName(bool ascending)
+/**
+ * @brief Перевіряє значення ID (з урахуванням регістру, як і пошук за ID)
+ */
+bool MatchesId(string_view value, Match match, const string& expected)
 {
-    sort(m_subjects.begin(), m_subjects.end(),
-        [ascending](const Subject& a, const Subject& b)
-        {
-            return ascending ? a.getSubjectName() < b.getSubjectName()
-                            : a.getSubjectName() > b.getSubjectName();
-        });
+    switch (match)
+    {
+        case Match::Equals:
+            return value == expected;
+        case Match::Contains:
+            return value.find(expected) != string::npos;
+        case Match::StartsWith:
+            return value.compare(0, expected.size(), expected) == 0;
+        case Match::Less:
+            return value < expected;
+        case Match::Greater:
+            return value > expected;
+    }
+    return false;
 }
 
-void DatabaseManager::DisplaySortedStudents(bool ascending)
+bool MatchesNumber(int value, Match match, int expected)
 {
-    SortStudentsByName(ascending);
-    vector<Student> students = GetAllStudents();
-
-    if (students.empty())
+    switch (match)
     {
-        cout << " Немає студентів для відображення" << endl;
-        return;
+        case Match::Equals:
+            return value == expected;
+        case Match::Less:
+            return value < expected;
+        case Match::Greater:
+            return value > expected;
+        case Match::Contains:
+        case Match::StartsWith:
+            return false;
     }
+    return false;
+}
 
-    cout << "=== " << (ascending ? "ВІДСОРТОВАНІ СТУДЕНТИ (A-Z)"
-                                : "ВІДСОРТОВАНІ СТУДЕНТИ (Z-A)") << " ===" << endl;
-    for (size_t i = 0; i < students.size(); i++)
+/**
+ * @class SymbolFilter
+ * @brief Умова на категоріальне поле, перевірена заздалегідь для кожного символу
+ *
+ * Різних програм, кафедр і ID викладачів лише кілька сотень, тож умова
+ * перевіряється один раз для кожного значення таблиці символів, а перевірка
+ * запису зводиться до читання прапорця за номером символу. Значення, додані
+ * після створення фільтра, перевіряються за текстом.
+ */
+class SymbolFilter {
+private:
+    vector<char> m_matches;  ///< Результат умови для кожного номера символу
+    Match m_match = Match::Equals;
+    string m_expected;       ///< Очікуване значення (згорнуте, якщо !m_exact)
+    bool m_exact = false;    ///< Порівняння з урахуванням регістру (як для ID)
+
+    bool Evaluate(Symbol symbol) const
     {
-        cout << i + 1 << ". " << students[i].getFullName()
-             << " (ID: " << students[i].getStudentID()
-             << ", Програма: " << students[i].getEducationalProgram() << ")" << endl;
+        const string& text = symbol.GetText();
+        return m_exact ? MatchesId(text, m_match, m_expected) : MatchesText(text, m_match, m_expected);
     }
-}
 
-void DatabaseManager::DisplaySortedTeachers(bool ascending)
-{
-    SortTeachersByName(ascending);
-    vector<Teacher> teachers = GetAllTeachers();
+public:
+    SymbolFilter() = default;
 
-    if (teachers.empty())
+    SymbolFilter(Match match, const string& expected, bool exact)
+        : m_match(match), m_expected(expected), m_exact(exact)
     {
-        cout << " Немає викладачів для відображення" << endl;
-        return;
+        size_t count = SymbolTable::GetCount();
+        m_matches.resize(count);
+        for (uint32_t id = 0; id < count; id++)
+        {
+            m_matches[id] = Evaluate(Symbol{id});
+        }
     }
 
-    cout << "=== " << (ascending ? "ВІДСОРТОВАНІ ВИКЛАДАЧІ (A-Z)"
-                                : "ВІДСОРТОВАНІ ВИКЛАДАЧІ (Z-A)") << " ===" << endl;
-    for (size_t i = 0; i < teachers.size(); i++)
+    bool operator()(Symbol symbol) const
     {
-        cout << i + 1 << ". " << teachers[i].getFullName()
-             << " (ID: " << teachers[i].getTeacherID()
-             << ", Кафедра: " << teachers[i].getDepartment() << ")" << endl;
+        return symbol.id < m_matches.size() ? m_matches[symbol.id] != 0 : Evaluate(symbol);
     }
-}
-
-void DatabaseManager::DisplaySortedSubjects(bool ascending)
+};
+
+/**
+ * @brief Порівнює повні імена "Ім'я Прізвище" двох осіб без складання рядків
+ * @return Від'ємне, нуль чи додатне значення, як std::string::compare
+ */
+int CompareFullNames(string_view leftName, string_view leftLastName,
+                     string_view rightName, string_view rightLastName)
 {
-    SortSubjectsByName(ascending);
-    vector<Subject> subjects = GetAllSubjects();
-
-    if (subjects.empty())
+    auto at = [](string_view name, string_view lastName, size_t i)
     {
-        cout << " Немає предметів для відображення" << endl;
-        return;
-    }
-
-    cout << "=== " << (ascending ? "ВІДСОРТОВАНІ ПРЕДМЕТИ (A-Z)"
-                                : "ВІДСОРТОВАНІ ПРЕДМЕТИ (Z-A)") << " ===" << endl;
-    for (size_t i = 0; i < subjects.size(); i++)
+        char c = i < name.size() ? name[i] : i == name.size() ? ' ' : lastName[i - name.size() - 1];
+        return static_cast<unsigned char>(c);
+    };
+    size_t leftSize = leftName.size() + 1 + leftLastName.size();
+    size_t rightSize = rightName.size() + 1 + rightLastName.size();
+    for (size_t i = 0; i < min(leftSize, rightSize); i++)
     {
-        cout << i + 1 << ". " << subjects[i].getSubjectName()
-             << " (ID: " << subjects[i].getSubjectId()
-             << ", Семестр: " << subjects[i].getSemester()
-             << ", Кредити: " << subjects[i].getEctsCredits() << ")" << endl;
+        unsigned char left = at(leftName, leftLastName, i);
+        unsigned char right = at(rightName, rightLastName, i);
+        if (left != right)
+        {
+            return left < right ? -1 : 1;
+        }
     }
+    return leftSize < rightSize ? -1 : leftSize > rightSize ? 1 : 0;
 }
 
-vector<Student> DatabaseManager::GetSortedStudentsByName(bool ascending)
-{
-    SortStudentsByName(ascending);
-    return m_students;
-}
-
-vector<Teacher> DatabaseManager::GetSortedTeachersByName(bool ascending)
+/**
+ * @brief Повертає текстове поле студента, читаючи рядок таблиці без створення об'єкта
+ * @param buffer Буфер для складеного значення (повне ім'я)
+ */
+string_view StudentFieldValue(const RecordTable<Student>& students, size_t position, StudentField field,
+                              string& buffer)
 {
-    SortTeachersByName(ascending);
-    return m_teachers;
+    const auto& row = students.GetRow(position);
+    switch (field)
+    {
+        case StudentField::Id:        return students.GetId(position);
+        case StudentField::FirstName: return students.GetText(row.name);
+        case StudentField::LastName:  return students.GetText(row.lastName);
+        case StudentField::FullName:
+            buffer.assign(students.GetText(row.name));
+            buffer += ' ';
+            buffer += students.GetText(row.lastName);
+            return buffer;
+        case StudentField::Email:     return students.GetText(row.email);
+        case StudentField::Program:   return row.program.GetText();
+    }
+    return {};
 }
 
-vector<Subject> DatabaseManager::GetSortedSubjectsByName(bool ascending)
+string_view TeacherFieldValue(const RecordTable<Teacher>& teachers, size_t position, TeacherField field,
+                              string& buffer)
 {
-    SortSubjectsByName(ascending);
-    return m_subjects;
+    const auto& row = teachers.GetRow(position);
+    switch (field)
+    {
+        case TeacherField::Id:         return teachers.GetId(position);
+        case TeacherField::FirstName:  return teachers.GetText(row.name);
+        case TeacherField::LastName:   return teachers.GetText(row.lastName);
+        case TeacherField::FullName:
+            buffer.assign(teachers.GetText(row.name));
+            buffer += ' ';
+            buffer += teachers.GetText(row.lastName);
+            return buffer;
+        case TeacherField::Email:      return teachers.GetText(row.email);
+        case TeacherField::Department: return row.department.GetText();
+    }
+    return {};
 }
 
-bool DatabaseManager::LoadFromFile(const string& studentsFile,
-                                   const string& teachersFile,
-                                   const string& subjectsFile)
+/**
+ * @brief Повертає текстове поле студента в нижньому регістрі, збережене в таблиці
+ * @details Лише для полів імені та email; ID і програма перевіряються окремо.
+ * @param buffer Буфер для складеного значення (повне ім'я)
+ */
+string_view StudentFoldedValue(const RecordTable<Student>& students, size_t position, StudentField field,
+                               string& buffer)
 {
-    bool success = true;
-
-    if (!LoadStudentsFromFile(studentsFile))
+    const auto& row = students.GetRow(position);
+    switch (field)
     {
-        cerr << "Помилка завантаження студентів з файлу: " << studentsFile << endl;
-        success = false;
+        case StudentField::FirstName: return students.GetFoldedText(row.name);
+        case StudentField::LastName:  return students.GetFoldedText(row.lastName);
+        case StudentField::FullName:
+            buffer.assign(students.GetFoldedText(row.name));
+            buffer += ' ';
+            buffer += students.GetFoldedText(row.lastName);
+            return buffer;
+        case StudentField::Email:     return students.GetFoldedText(row.email);
+        case StudentField::Id:
+        case StudentField::Program:   return {};
     }
+    return {};
+}
 
-    if (!LoadTeachersFromFile(teachersFile))
+string_view TeacherFoldedValue(const RecordTable<Teacher>& teachers, size_t position, TeacherField field,
+                               string& buffer)
+{
+    const auto& row = teachers.GetRow(position);
+    switch (field)
     {
-        cerr << "Помилка завантаження викладачів з файлу: " << teachersFile << endl;
-        success = false;
+        case TeacherField::FirstName:  return teachers.GetFoldedText(row.name);
+        case TeacherField::LastName:   return teachers.GetFoldedText(row.lastName);
+        case TeacherField::FullName:
+            buffer.assign(teachers.GetFoldedText(row.name));
+            buffer += ' ';
+            buffer += teachers.GetFoldedText(row.lastName);
+            return buffer;
+        case TeacherField::Email:      return teachers.GetFoldedText(row.email);
+        case TeacherField::Id:
+        case TeacherField::Department: return {};
     }
+    return {};
+}
 
-    if (!LoadSubjectsFromFile(subjectsFile))
+/**
+ * @brief Повертає текстове поле предмета
+ * @details Числові поля порівнюються через SubjectFieldNumber(), для них повертається порожній рядок.
+ */
+string_view SubjectFieldValue(const RecordTable<Subject>& subjects, size_t position, SubjectField field)
+{
+    const auto& row = subjects.GetRow(position);
+    switch (field)
     {
-        cerr << "Помилка завантаження предметів з файлу: " << subjectsFile << endl;
-        success = false;
+        case SubjectField::Id:        return subjects.GetId(position);
+        case SubjectField::Name:      return subjects.GetText(row.name);
+        case SubjectField::TeacherId: return row.teacherId.GetText();
+        case SubjectField::Credits:
+        case SubjectField::Semester:  return {};
     }
+    return {};
+}
 
-    return success;
+int SubjectFieldNumber(const RowLayout<Subject>::Row& row, SubjectField field)
+{
+    return field == SubjectField::Credits ? row.credits : row.semester;
 }
 
-bool DatabaseManager::SaveToFile(const string& studentsFile,
-                                 const string& teachersFile,
-                                 const string& subjectsFile) const
+bool IsNumericField(SubjectField field)
 {
-    return SaveStudentsToFile(studentsFile) &&
-           SaveTeachersToFile(teachersFile) &&
-           SaveSubjectsToFile(subjectsFile);
+    return field == SubjectField::Credits || field == SubjectField::Semester;
 }
 
-void DatabaseManager::Clear()
+/**
+ * @brief Чи дає умова на ім'я підрядок повного імені "Ім'я Прізвище"
+ * @details Тоді кандидатів можна взяти з триграмного індексу повних імен.
+ */
+bool IsNameSubstringCondition(Match match)
 {
-    m_students.clear();
-    m_teachers.clear();
-    m_subjects.clear();
+    return match == Match::Equals || match == Match::Contains || match == Match::StartsWith;
 }
 
-bool DatabaseManager::LoadStudentsFromFile(const string& filename)
+/**
+ * @brief Виконує запит за обраним планом
+ * @details Якщо запит упорядковано за полем впорядкованого індексу і жоден
+ * індекс умов не звужує вибірку суттєво, записи обходяться в порядку індексу
+ * з ранньою зупинкою на ліміті. Інакше кандидати беруться з найвибірковішого
+ * індексу (або з усієї колекції), перевіряються всі умови, а результат
+ * сортується - частково, якщо задано ліміт.
+ * @param matches Перевірка запису на позиції за всіма умовами
+ * @param less Порівняння записів на двох позиціях за полем впорядкування
+ * @param walkOrdered Обхід впорядкованого індексу (порожня функція, якщо він не підходить)
+ */
+template <typename Record, typename Field, typename Matches, typename Less>
+RecordView<Record> ExecuteQuery(ThreadPool* pool, const RecordTable<Record>& records, const Query<Field>& query,
+                                const vector<AccessPath>& paths, Matches matches, Less less,
+                                const function<void(const function<bool(size_t)>&)>& walkOrdered)
 {
-    ifstream file(filename);
-    if (!file.is_open())
+    const size_t limit = query.GetLimit();
+    if (limit == 0)
     {
-        cerr << "Не вдалося відкрити файл студентів: " << filename << endl;
-        return false;
+        return RecordView<Record>();
     }
 
-    m_students.clear();
-    string line;
-    while (getline(file, line))
+    const AccessPath* best = nullptr;
+    for (const auto& path : paths)
     {
-        if (line.empty())
+        if (!best || path.estimate < best->estimate)
         {
-            continue;
+            best = &path;
         }
+    }
 
-        stringstream ss(line);
-        string id, name, lastName, program, email;
+    vector<size_t> positions;
+    if (walkOrdered && (!best || best->estimate > records.Size() / 8))
+    {
+        walkOrdered([&](size_t position)
+        {
+            if (position < records.Size() && matches(position))
+            {
+                positions.push_back(position);
+            }
+            return positions.size() < limit;
+        });
+        return RecordView<Record>(records, std::move(positions));
+    }
 
-        if (getline(ss, id, ',') && getline(ss, name, ',') &&
-            getline(ss, lastName, ',') && getline(ss, program, ',') &&
-            getline(ss, email))
+    if (best)
+    {
+        vector<size_t> candidates = best->fetch();
+        sort(candidates.begin(), candidates.end());
+        candidates.erase(unique(candidates.begin(), candidates.end()), candidates.end());
+        positions = ScanMatching(pool, candidates.size(), [&records, &candidates, &matches](size_t i)
+            { return candidates[i] < records.Size() && matches(candidates[i]); });
+        for (size_t& position : positions)
         {
-            m_students.push_back(Student(name, lastName, email, id, program));
+            position = candidates[position];
         }
     }
+    else
+    {
+        positions = ScanMatching(pool, records.Size(), matches);
+    }
 
-    file.close();
-    return true;
+    if (query.IsOrdered())
+    {
+        KeepFirstInOrder(positions, limit, [&less, &query](size_t a, size_t b)
+        {
+            return query.IsAscending() ? less(a, b) : less(b, a);
+        });
+    }
+    else if (limit < positions.size())
+    {
+        positions.resize(limit);
+    }
+    return RecordView<Record>(records, std::move(positions));
+}
+
+
+} // namespace
+
+DatabaseManager::DatabaseManager()
+    : m_studentsFile(FileConstants::STUDENTS_FILE),
+      m_teachersFile(FileConstants::TEACHERS_FILE),
+      m_subjectsFile(FileConstants::SUBJECTS_FILE),
+      m_journal(FileConstants::JOURNAL_FILE),
+      m_checkpointInterval(DEFAULT_CHECKPOINT_INTERVAL),
+      m_loadState(LoadState::NotLoaded),
+      m_dirtyCollections(0),
+      m_threadPool(nullptr)
+{
+}
+
+DatabaseManager::DatabaseManager(const string& studentsFile,
+                                 const string& teachersFile,
+                                 const string& subjectsFile,
+                                 const string& journalFile)
+    : m_studentsFile(studentsFile),
+      m_teachersFile(teachersFile),
+      m_subjectsFile(subjectsFile),
+      m_journal(journalFile),
+      m_checkpointInterval(DEFAULT_CHECKPOINT_INTERVAL),
+      m_loadState(LoadState::NotLoaded),
+      m_dirtyCollections(0),
+      m_threadPool(nullptr)
+{
+}
+
+DatabaseManager::~DatabaseManager()
+{
+    StopFlusher();
+
+    // Зміни могли не потрапити в журнал (наприклад, він недоступний),
+    // тому перевіряємо маску змінених колекцій, а не кількість записів журналу
+    bool hasChanges;
+    {
+        lock_guard<mutex> pendingLock(m_pendingMutex);
+        hasChanges = m_dirtyCollections != 0 || !m_pendingRecords.empty();
+    }
+    if (hasChanges)
+    {
+        Checkpoint();
+    }
+}
+
+bool DatabaseManager::AddStudent(const Student& student)
+{
+    if (!student.isValid())
+    {
+        throw invalid_argument("Некоректні дані студента");
+    }
+    if (FindStudentPosition(student.getStudentID()) != NOT_FOUND)
+    {
+        throw invalid_argument("Студент з таким ID вже існує: " + student.getStudentID());
+    }
+    {
+        lock_guard<mutex> lock(m_dataMutex);
+        AppendIndexed(m_students, m_studentIndex, m_studentSlots, student, StudentIndexes());
+    }
+    LogMutation(JournalOperation::Add, JournalCollection::Students,
+                student.getStudentID(), FormatStudentRecord(student));
+    return true;
+}
+
+bool DatabaseManager::AddTeacher(const Teacher& teacher)
+{
+    if (!teacher.isValid())
+    {
+        throw invalid_argument("Некоректні дані викладача");
+    }
+    if (FindTeacherPosition(teacher.getTeacherID()) != NOT_FOUND)
+    {
+        throw invalid_argument("Викладач з таким ID вже існує: " + teacher.getTeacherID());
+    }
+    {
+        lock_guard<mutex> lock(m_dataMutex);
+        AppendIndexed(m_teachers, m_teacherIndex, m_teacherSlots, teacher, TeacherIndexes());
+    }
+    LogMutation(JournalOperation::Add, JournalCollection::Teachers,
+                teacher.getTeacherID(), FormatTeacherRecord(teacher));
+    return true;
+}
+
+bool DatabaseManager::AddSubject(const Subject& subject)
+{
+    if (!subject.isValid())
+    {
+        throw invalid_argument("Некоректні дані предмета");
+    }
+    if (FindSubjectPosition(subject.getSubjectId()) != NOT_FOUND)
+    {
+        throw invalid_argument("Предмет з таким ID вже існує: " + subject.getSubjectId());
+    }
+    {
+        lock_guard<mutex> lock(m_dataMutex);
+        AppendIndexed(m_subjects, m_subjectIndex, m_subjectSlots, subject, SubjectIndexes());
+    }
+    LogMutation(JournalOperation::Add, JournalCollection::Subjects,
+                subject.getSubjectId(), FormatSubjectRecord(subject));
+    return true;
+}
+
+bool DatabaseManager::EditStudent(const string& studentId, const Student& newData)
+{
+    return EditStudentAt(FindStudentPosition(studentId), newData);
+}
+
+bool DatabaseManager::EditStudent(StudentHandle handle, const Student& newData)
+{
+    size_t position = m_studentSlots.Resolve(handle);
+    return EditStudentAt(position < m_students.Size() ? position : NOT_FOUND, newData);
+}
+
+bool DatabaseManager::EditStudentAt(size_t position, const Student& newData)
+{
+    if (!newData.isValid())
+    {
+        throw invalid_argument("Некоректні нові дані студента");
+    }
+    if (position == NOT_FOUND)
+    {
+        return false;
+    }
+    const string studentId(m_students.GetId(position));
+    if (newData.getStudentID() != studentId && FindStudentPosition(newData.getStudentID()) != NOT_FOUND)
+    {
+        throw invalid_argument("Студент з таким ID вже існує: " + newData.getStudentID());
+    }
+    {
+        lock_guard<mutex> lock(m_dataMutex);
+        ReplaceIndexed(m_students, m_studentIndex, m_studentSlots, position, newData, StudentIndexes());
+    }
+    LogMutation(JournalOperation::Edit, JournalCollection::Students,
+                studentId, FormatStudentRecord(newData));
+    return true;
+}
+
+bool DatabaseManager::EditTeacher(const string& teacherId, const Teacher& newData)
+{
+    return EditTeacherAt(FindTeacherPosition(teacherId), newData);
+}
+
+bool DatabaseManager::EditTeacher(TeacherHandle handle, const Teacher& newData)
+{
+    size_t position = m_teacherSlots.Resolve(handle);
+    return EditTeacherAt(position < m_teachers.Size() ? position : NOT_FOUND, newData);
+}
+
+bool DatabaseManager::EditTeacherAt(size_t position, const Teacher& newData)
+{
+    if (!newData.isValid())
+    {
+        throw invalid_argument("Некоректні нові дані викладача");
+    }
+    if (position == NOT_FOUND)
+    {
+        return false;
+    }
+    const string teacherId(m_teachers.GetId(position));
+    if (newData.getTeacherID() != teacherId && FindTeacherPosition(newData.getTeacherID()) != NOT_FOUND)
+    {
+        throw invalid_argument("Викладач з таким ID вже існує: " + newData.getTeacherID());
+    }
+    {
+        lock_guard<mutex> lock(m_dataMutex);
+        ReplaceIndexed(m_teachers, m_teacherIndex, m_teacherSlots, position, newData, TeacherIndexes());
+    }
+    LogMutation(JournalOperation::Edit, JournalCollection::Teachers,
+                teacherId, FormatTeacherRecord(newData));
+    return true;
+}
+
+bool DatabaseManager::EditSubject(const string& subjectId, const Subject& newData)
+{
+    return EditSubjectAt(FindSubjectPosition(subjectId), newData);
+}
+
+bool DatabaseManager::EditSubject(SubjectHandle handle, const Subject& newData)
+{
+    size_t position = m_subjectSlots.Resolve(handle);
+    return EditSubjectAt(position < m_subjects.Size() ? position : NOT_FOUND, newData);
+}
+
+bool DatabaseManager::EditSubjectAt(size_t position, const Subject& newData)
+{
+    if (!newData.isValid())
+    {
+        throw invalid_argument("Некоректні нові дані предмета");
+    }
+    if (position == NOT_FOUND)
+    {
+        return false;
+    }
+    const string subjectId(m_subjects.GetId(position));
+    if (newData.getSubjectId() != subjectId && FindSubjectPosition(newData.getSubjectId()) != NOT_FOUND)
+    {
+        throw invalid_argument("Предмет з таким ID вже існує: " + newData.getSubjectId());
+    }
+    {
+        lock_guard<mutex> lock(m_dataMutex);
+        ReplaceIndexed(m_subjects, m_subjectIndex, m_subjectSlots, position, newData, SubjectIndexes());
+    }
+    LogMutation(JournalOperation::Edit, JournalCollection::Subjects,
+                subjectId, FormatSubjectRecord(newData));
+    return true;
+}
+
+bool DatabaseManager::DeleteStudent(const string& studentId)
+{
+    size_t position = FindStudentPosition(studentId);
+    if (position == NOT_FOUND)
+    {
+        return false;
+    }
+    {
+        lock_guard<mutex> lock(m_dataMutex);
+        EraseIndexed(m_students, m_studentIndex, m_studentSlots, position, StudentIndexes());
+    }
+    LogMutation(JournalOperation::Delete, JournalCollection::Students, studentId, "");
+    return true;
+}
+
+bool DatabaseManager::DeleteTeacher(const string& teacherId)
+{
+    size_t position = FindTeacherPosition(teacherId);
+    if (position == NOT_FOUND)
+    {
+        return false;
+    }
+    {
+        lock_guard<mutex> lock(m_dataMutex);
+        EraseIndexed(m_teachers, m_teacherIndex, m_teacherSlots, position, TeacherIndexes());
+    }
+    LogMutation(JournalOperation::Delete, JournalCollection::Teachers, teacherId, "");
+    return true;
+}
+
+bool DatabaseManager::DeleteSubject(const string& subjectId)
+{
+    size_t position = FindSubjectPosition(subjectId);
+    if (position == NOT_FOUND)
+    {
+        return false;
+    }
+    {
+        lock_guard<mutex> lock(m_dataMutex);
+        EraseIndexed(m_subjects, m_subjectIndex, m_subjectSlots, position, SubjectIndexes());
+    }
+    LogMutation(JournalOperation::Delete, JournalCollection::Subjects, subjectId, "");
+    return true;
+}
+
+vector<Student> DatabaseManager::GetAllStudents() const
+{
+    vector<Student> result;
+    result.reserve(m_students.Size());
+    for (size_t i = 0; i < m_students.Size(); i++)
+    {
+        result.push_back(m_students.Get(i));
+    }
+    return result;
+}
+
+vector<Teacher> DatabaseManager::GetAllTeachers() const
+{
+    vector<Teacher> result;
+    result.reserve(m_teachers.Size());
+    for (size_t i = 0; i < m_teachers.Size(); i++)
+    {
+        result.push_back(m_teachers.Get(i));
+    }
+    return result;
+}
+
+vector<Subject> DatabaseManager::GetAllSubjects() const
+{
+    vector<Subject> result;
+    result.reserve(m_subjects.Size());
+    for (size_t i = 0; i < m_subjects.Size(); i++)
+    {
+        result.push_back(m_subjects.Get(i));
+    }
+    return result;
+}
+
+StudentView DatabaseManager::ViewAllStudents() const
+{
+    return StudentView(m_students);
+}
+
+TeacherView DatabaseManager::ViewAllTeachers() const
+{
+    return TeacherView(m_teachers);
+}
+
+SubjectView DatabaseManager::ViewAllSubjects() const
+{
+    return SubjectView(m_subjects);
+}
+
+optional<Student> DatabaseManager::GetStudent(const string& studentId)
+{
+    size_t position = FindStudentPosition(studentId);
+    return position != NOT_FOUND ? optional<Student>(m_students.Get(position)) : nullopt;
+}
+
+optional<Teacher> DatabaseManager::GetTeacher(const string& teacherId)
+{
+    size_t position = FindTeacherPosition(teacherId);
+    return position != NOT_FOUND ? optional<Teacher>(m_teachers.Get(position)) : nullopt;
+}
+
+optional<Subject> DatabaseManager::GetSubject(const string& subjectId)
+{
+    size_t position = FindSubjectPosition(subjectId);
+    return position != NOT_FOUND ? optional<Subject>(m_subjects.Get(position)) : nullopt;
+}
+
+StudentHandle DatabaseManager::GetStudentHandle(const string& studentId)
+{
+    size_t position = FindStudentPosition(studentId);
+    if (position == NOT_FOUND)
+    {
+        return StudentHandle();
+    }
+    return m_studentSlots.HandleAt(position);
+}
+
+TeacherHandle DatabaseManager::GetTeacherHandle(const string& teacherId)
+{
+    size_t position = FindTeacherPosition(teacherId);
+    if (position == NOT_FOUND)
+    {
+        return TeacherHandle();
+    }
+    return m_teacherSlots.HandleAt(position);
+}
+
+SubjectHandle DatabaseManager::GetSubjectHandle(const string& subjectId)
+{
+    size_t position = FindSubjectPosition(subjectId);
+    if (position == NOT_FOUND)
+    {
+        return SubjectHandle();
+    }
+    return m_subjectSlots.HandleAt(position);
+}
+
+optional<Student> DatabaseManager::GetStudent(StudentHandle handle)
+{
+    size_t position = m_studentSlots.Resolve(handle);
+    return position < m_students.Size() ? optional<Student>(m_students.Get(position)) : nullopt;
+}
+
+optional<Teacher> DatabaseManager::GetTeacher(TeacherHandle handle)
+{
+    size_t position = m_teacherSlots.Resolve(handle);
+    return position < m_teachers.Size() ? optional<Teacher>(m_teachers.Get(position)) : nullopt;
+}
+
+optional<Subject> DatabaseManager::GetSubject(SubjectHandle handle)
+{
+    size_t position = m_subjectSlots.Resolve(handle);
+    return position < m_subjects.Size() ? optional<Subject>(m_subjects.Get(position)) : nullopt;
+}
+
+StudentView DatabaseManager::RunQuery(const StudentQuery& query) const
+{
+    vector<string> folded;
+    for (const auto& condition : query.GetConditions())
+    {
+        folded.push_back(condition.field == StudentField::Id ? condition.text
+                                                             : TextUtils::FoldCase(condition.text));
+    }
+    vector<SymbolFilter> symbolFilters(folded.size());
+    for (size_t i = 0; i < folded.size(); i++)
+    {
+        const auto& condition = query.GetConditions()[i];
+        if (condition.field == StudentField::Program)
+        {
+            symbolFilters[i] = SymbolFilter(condition.match, folded[i], false);
+        }
+    }
+    const auto& students = m_students;
+    auto matches = [&students, &query, &folded, &symbolFilters](size_t position)
+    {
+        thread_local string buffer;
+        const auto& conditions = query.GetConditions();
+        for (size_t i = 0; i < conditions.size(); i++)
+        {
+            bool matched;
+            if (conditions[i].field == StudentField::Program)
+            {
+                matched = symbolFilters[i](students.GetRow(position).program);
+            }
+            else if (conditions[i].field == StudentField::Id)
+            {
+                matched = MatchesId(students.GetId(position), conditions[i].match, folded[i]);
+            }
+            else
+            {
+                matched = MatchesFolded(StudentFoldedValue(students, position, conditions[i].field, buffer),
+                                        conditions[i].match, folded[i]);
+            }
+            if (!matched)
+            {
+                return false;
+            }
+        }
+        return true;
+    };
+    auto less = [&students, &query](size_t a, size_t b)
+    {
+        // Буфери потоку перевикористовуються: порівняння повних імен не виділяє пам'ять
+        thread_local string left, right;
+        return StudentFieldValue(students, a, query.GetOrderField(), left) <
+               StudentFieldValue(students, b, query.GetOrderField(), right);
+    };
+
+    vector<AccessPath> paths;
+    function<void(const function<bool(size_t)>&)> walkOrdered;
+    const auto& conditions = query.GetConditions();
+    for (size_t i = 0; i < conditions.size(); i++)
+    {
+        const string& value = folded[i];
+        Match match = conditions[i].match;
+        switch (conditions[i].field)
+        {
+            case StudentField::Program:
+            {
+                auto keyMatches = [filter = &symbolFilters[i]](Symbol key) { return (*filter)(key); };
+                paths.push_back(AccessPath{m_programIndex.CountMatching(keyMatches),
+                    [this, keyMatches] { return ResolvePositions(m_studentSlots, m_programIndex.Collect(keyMatches)); }});
+                break;
+            }
+            case StudentField::FirstName:
+            case StudentField::LastName:
+            case StudentField::FullName:
+                if (IsNameSubstringCondition(match))
+                {
+                    paths.push_back(AccessPath{m_studentNameIndex.EstimateCandidates(value),
+                        [this, value] { return ResolvePositions(m_studentSlots, m_studentNameIndex.Search(value)); }});
+                }
+                break;
+            case StudentField::Id:
+                if (match == Match::Equals)
+                {
+                    size_t position = FindStudentPosition(value);
+                    paths.push_back(AccessPath{1, [position] {
+                        return position != NOT_FOUND ? vector<size_t>{position} : vector<size_t>(); }});
+                }
+                break;
+            default:
+                break;
+        }
+    }
+    if (query.IsOrdered() && query.GetOrderField() == StudentField::FullName)
+    {
+        walkOrdered = [this, &query](const function<bool(size_t)>& visit)
+        {
+            m_studentOrder.ForEach(query.IsAscending(), [this, &visit](StudentHandle handle)
+                { return visit(m_studentSlots.Resolve(handle)); });
+        };
+    }
+    return ExecuteQuery(m_threadPool, m_students, query, paths, matches, less, walkOrdered);
+}
+
+TeacherView DatabaseManager::RunQuery(const TeacherQuery& query) const
+{
+    vector<string> folded;
+    for (const auto& condition : query.GetConditions())
+    {
+        folded.push_back(condition.field == TeacherField::Id ? condition.text
+                                                             : TextUtils::FoldCase(condition.text));
+    }
+    vector<SymbolFilter> symbolFilters(folded.size());
+    for (size_t i = 0; i < folded.size(); i++)
+    {
+        const auto& condition = query.GetConditions()[i];
+        if (condition.field == TeacherField::Department)
+        {
+            symbolFilters[i] = SymbolFilter(condition.match, folded[i], false);
+        }
+    }
+    const auto& teachers = m_teachers;
+    auto matches = [&teachers, &query, &folded, &symbolFilters](size_t position)
+    {
+        thread_local string buffer;
+        const auto& conditions = query.GetConditions();
+        for (size_t i = 0; i < conditions.size(); i++)
+        {
+            bool matched;
+            if (conditions[i].field == TeacherField::Department)
+            {
+                matched = symbolFilters[i](teachers.GetRow(position).department);
+            }
+            else if (conditions[i].field == TeacherField::Id)
+            {
+                matched = MatchesId(teachers.GetId(position), conditions[i].match, folded[i]);
+            }
+            else
+            {
+                matched = MatchesFolded(TeacherFoldedValue(teachers, position, conditions[i].field, buffer),
+                                        conditions[i].match, folded[i]);
+            }
+            if (!matched)
+            {
+                return false;
+            }
+        }
+        return true;
+    };
+    auto less = [&teachers, &query](size_t a, size_t b)
+    {
+        // Буфери потоку перевикористовуються: порівняння повних імен не виділяє пам'ять
+        thread_local string left, right;
+        return TeacherFieldValue(teachers, a, query.GetOrderField(), left) <
+               TeacherFieldValue(teachers, b, query.GetOrderField(), right);
+    };
+
+    vector<AccessPath> paths;
+    function<void(const function<bool(size_t)>&)> walkOrdered;
+    const auto& conditions = query.GetConditions();
+    for (size_t i = 0; i < conditions.size(); i++)
+    {
+        const string& value = folded[i];
+        Match match = conditions[i].match;
+        switch (conditions[i].field)
+        {
+            case TeacherField::Department:
+            {
+                auto keyMatches = [filter = &symbolFilters[i]](Symbol key) { return (*filter)(key); };
+                paths.push_back(AccessPath{m_departmentIndex.CountMatching(keyMatches),
+                    [this, keyMatches] { return ResolvePositions(m_teacherSlots, m_departmentIndex.Collect(keyMatches)); }});
+                break;
+            }
+            case TeacherField::FirstName:
+            case TeacherField::LastName:
+            case TeacherField::FullName:
+                if (IsNameSubstringCondition(match))
+                {
+                    paths.push_back(AccessPath{m_teacherNameIndex.EstimateCandidates(value),
+                        [this, value] { return ResolvePositions(m_teacherSlots, m_teacherNameIndex.Search(value)); }});
+                }
+                break;
+            case TeacherField::Id:
+                if (match == Match::Equals)
+                {
+                    size_t position = FindTeacherPosition(value);
+                    paths.push_back(AccessPath{1, [position] {
+                        return position != NOT_FOUND ? vector<size_t>{position} : vector<size_t>(); }});
+                }
+                break;
+            default:
+                break;
+        }
+    }
+    if (query.IsOrdered() && query.GetOrderField() == TeacherField::FullName)
+    {
+        walkOrdered = [this, &query](const function<bool(size_t)>& visit)
+        {
+            m_teacherOrder.ForEach(query.IsAscending(), [this, &visit](TeacherHandle handle)
+                { return visit(m_teacherSlots.Resolve(handle)); });
+        };
+    }
+    return ExecuteQuery(m_threadPool, m_teachers, query, paths, matches, less, walkOrdered);
+}
+
+SubjectView DatabaseManager::RunQuery(const SubjectQuery& query) const
+{
+    vector<string> folded;
+    for (const auto& condition : query.GetConditions())
+    {
+        if (IsNumericField(condition.field) && !condition.hasNumber)
+        {
+            throw invalid_argument("Нечислове значення для числового поля: " + condition.text);
+        }
+        bool exact = condition.field == SubjectField::Id || condition.field == SubjectField::TeacherId;
+        folded.push_back(exact ? condition.text : TextUtils::FoldCase(condition.text));
+    }
+    vector<SymbolFilter> symbolFilters(folded.size());
+    for (size_t i = 0; i < folded.size(); i++)
+    {
+        const auto& condition = query.GetConditions()[i];
+        if (condition.field == SubjectField::TeacherId)
+        {
+            symbolFilters[i] = SymbolFilter(condition.match, folded[i], true);
+        }
+    }
+    const auto& subjects = m_subjects;
+    auto matches = [&subjects, &query, &folded, &symbolFilters](size_t position)
+    {
+        const auto& row = subjects.GetRow(position);
+        const auto& conditions = query.GetConditions();
+        for (size_t i = 0; i < conditions.size(); i++)
+        {
+            const auto& condition = conditions[i];
+            bool matched;
+            if (IsNumericField(condition.field))
+            {
+                matched = MatchesNumber(SubjectFieldNumber(row, condition.field), condition.match, condition.number);
+            }
+            else if (condition.field == SubjectField::Name)
+            {
+                matched = MatchesFolded(subjects.GetFoldedText(row.name), condition.match, folded[i]);
+            }
+            else if (condition.field == SubjectField::TeacherId)
+            {
+                matched = symbolFilters[i](row.teacherId);
+            }
+            else
+            {
+                matched = MatchesId(SubjectFieldValue(subjects, position, condition.field), condition.match, folded[i]);
+            }
+            if (!matched)
+            {
+                return false;
+            }
+        }
+        return true;
+    };
+    auto less = [&subjects, &query](size_t a, size_t b)
+    {
+        SubjectField field = query.GetOrderField();
+        if (IsNumericField(field))
+        {
+            return SubjectFieldNumber(subjects.GetRow(a), field) < SubjectFieldNumber(subjects.GetRow(b), field);
+        }
+        return SubjectFieldValue(subjects, a, field) < SubjectFieldValue(subjects, b, field);
+    };
+
+    vector<AccessPath> paths;
+    function<void(const function<bool(size_t)>&)> walkOrdered;
+    const auto& conditions = query.GetConditions();
+    for (size_t i = 0; i < conditions.size(); i++)
+    {
+        const auto& condition = conditions[i];
+        if (condition.field == SubjectField::Semester && condition.match == Match::Equals)
+        {
+            const vector<SubjectHandle>* members = m_semesterIndex.Find(condition.number);
+            paths.push_back(AccessPath{members ? members->size() : 0, [this, members] {
+                return members ? ResolvePositions(m_subjectSlots, *members) : vector<size_t>(); }});
+        }
+        else if (condition.field == SubjectField::Name && IsNameSubstringCondition(condition.match))
+        {
+            const string& value = folded[i];
+            paths.push_back(AccessPath{m_subjectNameIndex.EstimateCandidates(value),
+                [this, value] { return ResolvePositions(m_subjectSlots, m_subjectNameIndex.Search(value)); }});
+        }
+        else if (condition.field == SubjectField::Id && condition.match == Match::Equals)
+        {
+            size_t position = FindSubjectPosition(condition.text);
+            paths.push_back(AccessPath{1, [position] {
+                return position != NOT_FOUND ? vector<size_t>{position} : vector<size_t>(); }});
+        }
+    }
+    if (query.IsOrdered() && query.GetOrderField() == SubjectField::Name)
+    {
+        walkOrdered = [this, &query](const function<bool(size_t)>& visit)
+        {
+            m_subjectOrder.ForEach(query.IsAscending(), [this, &visit](SubjectHandle handle)
+                { return visit(m_subjectSlots.Resolve(handle)); });
+        };
+    }
+    return ExecuteQuery(m_threadPool, m_subjects, query, paths, matches, less, walkOrdered);
+}
+
+vector<Student> DatabaseManager::SearchStudentsByName(const string& name) const
+{
+    return ViewStudentsByName(name).ToVector();
+}
+
+vector<Teacher> DatabaseManager::SearchTeachersByName(const string& name) const
+{
+    return ViewTeachersByName(name).ToVector();
+}
+
+vector<Subject> DatabaseManager::SearchSubjectsByName(const string& name) const
+{
+    return ViewSubjectsByName(name).ToVector();
+}
+
+vector<Student> DatabaseManager::FilterStudentsByProgram(const string& program) const
+{
+    return ViewStudentsByProgram(program).ToVector();
+}
+
+vector<Teacher> DatabaseManager::FilterTeachersByDepartment(const string& department) const
+{
+    return ViewTeachersByDepartment(department).ToVector();
+}
+
+vector<Subject> DatabaseManager::FilterSubjectsBySemester(int semester) const
+{
+    return ViewSubjectsBySemester(semester).ToVector();
+}
+
+StudentView DatabaseManager::ViewStudentsByName(const string& name) const
+{
+    string lowerName = TextUtils::FoldCase(name);
+    return CollectInOrder(m_students, m_studentSlots, m_studentNameIndex.Search(lowerName));
+}
+
+TeacherView DatabaseManager::ViewTeachersByName(const string& name) const
+{
+    string lowerName = TextUtils::FoldCase(name);
+    return CollectInOrder(m_teachers, m_teacherSlots, m_teacherNameIndex.Search(lowerName));
+}
+
+SubjectView DatabaseManager::ViewSubjectsByName(const string& name) const
+{
+    string lowerName = TextUtils::FoldCase(name);
+    return CollectInOrder(m_subjects, m_subjectSlots, m_subjectNameIndex.Search(lowerName));
+}
+
+StudentView DatabaseManager::ViewStudentsByNameFuzzy(const string& name, size_t maxDistance) const
+{
+    return FuzzySearch(m_students, m_studentSlots, m_studentNameIndex, name, maxDistance);
+}
+
+TeacherView DatabaseManager::ViewTeachersByNameFuzzy(const string& name, size_t maxDistance) const
+{
+    return FuzzySearch(m_teachers, m_teacherSlots, m_teacherNameIndex, name, maxDistance);
+}
+
+SubjectView DatabaseManager::ViewSubjectsByNameFuzzy(const string& name, size_t maxDistance) const
+{
+    return FuzzySearch(m_subjects, m_subjectSlots, m_subjectNameIndex, name, maxDistance);
+}
+
+StudentView DatabaseManager::ViewStudentsByProgram(const string& program) const
+{
+    SymbolFilter filter(Match::Contains, TextUtils::FoldCase(program), false);
+    return CollectInOrder(m_students, m_studentSlots,
+        m_programIndex.Collect([&filter](Symbol key) { return filter(key); }));
+}
+
+TeacherView DatabaseManager::ViewTeachersByDepartment(const string& department) const
+{
+    SymbolFilter filter(Match::Contains, TextUtils::FoldCase(department), false);
+    return CollectInOrder(m_teachers, m_teacherSlots,
+        m_departmentIndex.Collect([&filter](Symbol key) { return filter(key); }));
+}
+
+SubjectView DatabaseManager::ViewSubjectsBySemester(int semester) const
+{
+    const vector<SubjectHandle>* members = m_semesterIndex.Find(semester);
+    return members ? CollectInOrder(m_subjects, m_subjectSlots, *members) : SubjectView();
+}
+
+Symbol DatabaseManager::ProgramKey(const Student& student)
+{
+    return student.getEducationalProgramSymbol();
+}
+
+Symbol DatabaseManager::DepartmentKey(const Teacher& teacher)
+{
+    return teacher.getDepartmentSymbol();
+}
+
+int DatabaseManager::SemesterKey(const Subject& subject)
+{
+    return subject.getSemester();
+}
+
+string DatabaseManager::StudentNameKey(const Student& student)
+{
+    return TextUtils::FoldCase(student.getFullName());
+}
+
+string DatabaseManager::TeacherNameKey(const Teacher& teacher)
+{
+    return TextUtils::FoldCase(teacher.getFullName());
+}
+
+string DatabaseManager::SubjectNameKey(const Subject& subject)
+{
+    return TextUtils::FoldCase(subject.getSubjectName());
+}
+
+string DatabaseManager::StudentOrderKey(const Student& student)
+{
+    return student.getFullName();
+}
+
+string DatabaseManager::TeacherOrderKey(const Teacher& teacher)
+{
+    return teacher.getFullName();
+}
+
+string DatabaseManager::SubjectOrderKey(const Subject& subject)
+{
+    return subject.getSubjectName();
+}
+
+int DatabaseManager::CompareStudentOrder(StudentHandle left, StudentHandle right) const
+{
+    const auto& a = m_students.GetRow(m_studentSlots.Resolve(left));
+    const auto& b = m_students.GetRow(m_studentSlots.Resolve(right));
+    return CompareFullNames(m_students.GetText(a.name), m_students.GetText(a.lastName),
+                            m_students.GetText(b.name), m_students.GetText(b.lastName));
+}
+
+int DatabaseManager::CompareTeacherOrder(TeacherHandle left, TeacherHandle right) const
+{
+    const auto& a = m_teachers.GetRow(m_teacherSlots.Resolve(left));
+    const auto& b = m_teachers.GetRow(m_teacherSlots.Resolve(right));
+    return CompareFullNames(m_teachers.GetText(a.name), m_teachers.GetText(a.lastName),
+                            m_teachers.GetText(b.name), m_teachers.GetText(b.lastName));
+}
+
+int DatabaseManager::CompareSubjectOrder(SubjectHandle left, SubjectHandle right) const
+{
+    const auto& a = m_subjects.GetRow(m_subjectSlots.Resolve(left));
+    const auto& b = m_subjects.GetRow(m_subjectSlots.Resolve(right));
+    return m_subjects.GetText(a.name).compare(m_subjects.GetText(b.name));
+}
+
+void DatabaseManager::SortStudentsByName(bool ascending)
+{
+    lock_guard<mutex> lock(m_dataMutex);
+    SortIndexed(m_students, m_studentIndex, m_studentSlots, StudentOrderKey, ascending);
+}
+
+void DatabaseManager::SortTeachersByName(bool ascending)
+{
+    lock_guard<mutex> lock(m_dataMutex);
+    SortIndexed(m_teachers, m_teacherIndex, m_teacherSlots, TeacherOrderKey, ascending);
+}
+
+void DatabaseManager::SortSubjectsByName(bool ascending)
+{
+    lock_guard<mutex> lock(m_dataMutex);
+    SortIndexed(m_subjects, m_subjectIndex, m_subjectSlots, SubjectOrderKey, ascending);
+}
+
+void DatabaseManager::ForEachStudentByName(bool ascending,
+                                           const function<void(const Student&)>& visit) const
+{
+    VisitOrdered(m_students, m_studentSlots, m_studentOrder, ascending, visit);
+}
+
+void DatabaseManager::ForEachTeacherByName(bool ascending,
+                                           const function<void(const Teacher&)>& visit) const
+{
+    VisitOrdered(m_teachers, m_teacherSlots, m_teacherOrder, ascending, visit);
+}
+
+void DatabaseManager::ForEachSubjectByName(bool ascending,
+                                           const function<void(const Subject&)>& visit) const
+{
+    VisitOrdered(m_subjects, m_subjectSlots, m_subjectOrder, ascending, visit);
+}
+
+StudentView DatabaseManager::ViewTopStudentsByName(size_t count, bool ascending) const
+{
+    return TopOrdered(m_students, m_studentSlots, m_studentOrder, ascending, count);
+}
+
+TeacherView DatabaseManager::ViewTopTeachersByName(size_t count, bool ascending) const
+{
+    return TopOrdered(m_teachers, m_teacherSlots, m_teacherOrder, ascending, count);
+}
+
+SubjectView DatabaseManager::ViewTopSubjectsByName(size_t count, bool ascending) const
+{
+    return TopOrdered(m_subjects, m_subjectSlots, m_subjectOrder, ascending, count);
+}
+
+SubjectView DatabaseManager::ViewTopSubjectsByCredits(size_t count, bool ascending) const
+{
+    if (count == 0)
+    {
+        return SubjectView();
+    }
+    const auto& subjects = m_subjects;
+    return TopByOrder(subjects, count, [&subjects, ascending](size_t a, size_t b)
+    {
+        const auto& left = subjects.GetRow(a);
+        const auto& right = subjects.GetRow(b);
+        if (left.credits != right.credits)
+        {
+            return ascending ? left.credits < right.credits : left.credits > right.credits;
+        }
+        return subjects.GetText(left.name) < subjects.GetText(right.name);
+    });
+}
+
+void DatabaseManager::DisplaySortedStudents(bool ascending)
+{
+    if (m_students.Empty())
+    {
+        cout << " Немає студентів для відображення" << endl;
+        return;
+    }
+
+    cout << "=== " << (ascending ? "ВІДСОРТОВАНІ СТУДЕНТИ (A-Z)"
+                                : "ВІДСОРТОВАНІ СТУДЕНТИ (Z-A)") << " ===" << endl;
+    size_t number = 0;
+    ForEachStudentByName(ascending, [&number](const Student& student)
+    {
+        cout << ++number << ". " << student.getFullName()
+             << " (ID: " << student.getStudentID()
+             << ", Програма: " << student.getEducationalProgram() << ")" << endl;
+    });
+}
+
+void DatabaseManager::DisplaySortedTeachers(bool ascending)
+{
+    if (m_teachers.Empty())
+    {
+        cout << " Немає викладачів для відображення" << endl;
+        return;
+    }
+
+    cout << "=== " << (ascending ? "ВІДСОРТОВАНІ ВИКЛАДАЧІ (A-Z)"
+                                : "ВІДСОРТОВАНІ ВИКЛАДАЧІ (Z-A)") << " ===" << endl;
+    size_t number = 0;
+    ForEachTeacherByName(ascending, [&number](const Teacher& teacher)
+    {
+        cout << ++number << ". " << teacher.getFullName()
+             << " (ID: " << teacher.getTeacherID()
+             << ", Кафедра: " << teacher.getDepartment() << ")" << endl;
+    });
+}
+
+void DatabaseManager::DisplaySortedSubjects(bool ascending)
+{
+    if (m_subjects.Empty())
+    {
+        cout << " Немає предметів для відображення" << endl;
+        return;
+    }
+
+    cout << "=== " << (ascending ? "ВІДСОРТОВАНІ ПРЕДМЕТИ (A-Z)"
+                                : "ВІДСОРТОВАНІ ПРЕДМЕТИ (Z-A)") << " ===" << endl;
+    size_t number = 0;
+    ForEachSubjectByName(ascending, [&number](const Subject& subject)
+    {
+        cout << ++number << ". " << subject.getSubjectName()
+             << " (ID: " << subject.getSubjectId()
+             << ", Семестр: " << subject.getSemester()
+             << ", Кредити: " << subject.getEctsCredits() << ")" << endl;
+    });
+}
+
+vector<Student> DatabaseManager::GetSortedStudentsByName(bool ascending)
+{
+    vector<Student> result;
+    result.reserve(m_students.Size());
+    ForEachStudentByName(ascending, [&result](const Student& student) { result.push_back(student); });
+    return result;
+}
+
+vector<Teacher> DatabaseManager::GetSortedTeachersByName(bool ascending)
+{
+    vector<Teacher> result;
+    result.reserve(m_teachers.Size());
+    ForEachTeacherByName(ascending, [&result](const Teacher& teacher) { result.push_back(teacher); });
+    return result;
+}
+
+vector<Subject> DatabaseManager::GetSortedSubjectsByName(bool ascending)
+{
+    vector<Subject> result;
+    result.reserve(m_subjects.Size());
+    ForEachSubjectByName(ascending, [&result](const Subject& subject) { result.push_back(subject); });
+    return result;
+}
+
+bool DatabaseManager::LoadFromFile(const string& studentsFile,
+                                   const string& teachersFile,
+                                   const string& subjectsFile,
+                                   vector<SourceLoadResult>* results)
+{
+    // Накопичені зміни мають потрапити в журнал до його відтворення
+    if (m_flusher)
+    {
+        m_flusher->Flush();
+    }
+
+    lock_guard<mutex> persistenceLock(m_persistenceMutex);
+    lock_guard<mutex> dataLock(m_dataMutex);
+
+    m_loadState = LoadState::Loading;
+    m_studentsFile = studentsFile;
+    m_teachersFile = teachersFile;
+    m_subjectsFile = subjectsFile;
+
+    // Конструктори осіб перевіряють символи з урахуванням локалі, тож локаль
+    // налаштовується до того, як записи почнуть створюватися в кількох потоках
+    Person::initializeUkrainianSupport();
+
+    // Колекції та їхні файли незалежні, тож завантажуються одночасно
+    auto timed = [](const string& source, auto load)
+    {
+        auto start = chrono::steady_clock::now();
+        bool success = load();
+        return SourceLoadResult{source, success,
+            chrono::duration_cast<chrono::milliseconds>(chrono::steady_clock::now() - start)};
+    };
+
+    auto students = async(launch::async, [&]()
+    {
+        return timed("Студенти", [&]() { return LoadStudentsFromFile(studentsFile); });
+    });
+    auto teachers = async(launch::async, [&]()
+    {
+        return timed("Викладачі", [&]() { return LoadTeachersFromFile(teachersFile); });
+    });
+    SourceLoadResult subjectsResult =
+        timed("Предмети", [&]() { return LoadSubjectsFromFile(subjectsFile); });
+    SourceLoadResult studentsResult = students.get();
+    SourceLoadResult teachersResult = teachers.get();
+
+    bool success = true;
+    if (!studentsResult.success)
+    {
+        cerr << "Помилка завантаження студентів з файлу: " << studentsFile << endl;
+        success = false;
+    }
+
+    if (!teachersResult.success)
+    {
+        cerr << "Помилка завантаження викладачів з файлу: " << teachersFile << endl;
+        success = false;
+    }
+
+    if (!subjectsResult.success)
+    {
+        cerr << "Помилка завантаження предметів з файлу: " << subjectsFile << endl;
+        success = false;
+    }
+
+    RebuildIndexes();
+    ReplayJournal();
+    m_loadState = LoadState::Loaded;
+
+    if (results)
+    {
+        results->push_back(studentsResult);
+        results->push_back(teachersResult);
+        results->push_back(subjectsResult);
+    }
+    return success;
+}
+
+bool DatabaseManager::Open(vector<SourceLoadResult>* results)
+{
+    {
+        lock_guard<mutex> lock(m_persistenceMutex);
+        if (m_loadState == LoadState::Loaded)
+        {
+            return true;
+        }
+    }
+    return LoadFromFile(m_studentsFile, m_teachersFile, m_subjectsFile, results);
+}
+
+LoadState DatabaseManager::GetLoadState() const
+{
+    lock_guard<mutex> lock(m_persistenceMutex);
+    return m_loadState;
+}
+
+bool DatabaseManager::SaveToFile(const string& studentsFile,
+                                 const string& teachersFile,
+                                 const string& subjectsFile) const
+{
+    return SaveStudentsToFile(studentsFile) &&
+           SaveTeachersToFile(teachersFile) &&
+           SaveSubjectsToFile(subjectsFile);
+}
+
+bool DatabaseManager::Checkpoint()
+{
+    lock_guard<mutex> lock(m_persistenceMutex);
+    return CheckpointLocked();
+}
+
+bool DatabaseManager::CheckpointLocked()
+{
+    // До завантаження колекції неповні: перезапис CSV знищив би дані,
+    // тож зміни залишаються в журналі до наступного відтворення
+    if (m_loadState != LoadState::Loaded)
+    {
+        return false;
+    }
+
+    // Маска скидається до знімка: зміни, зроблені під час запису, знову її позначать
+    unsigned dirty;
+    {
+        lock_guard<mutex> pendingLock(m_pendingMutex);
+        dirty = m_dirtyCollections;
+        m_dirtyCollections = 0;
+    }
+
+    const unsigned studentsBit = CollectionBit(JournalCollection::Students);
+    const unsigned teachersBit = CollectionBit(JournalCollection::Teachers);
+    const unsigned subjectsBit = CollectionBit(JournalCollection::Subjects);
+
+    // Під блокуванням лише формуємо вміст, запис на диск відбувається без нього
+    string studentsContent, teachersContent, subjectsContent;
+    string studentsSnapshot, teachersSnapshot, subjectsSnapshot;
+    uint32_t studentsCount = 0, teachersCount = 0, subjectsCount = 0;
+    {
+        lock_guard<mutex> dataLock(m_dataMutex);
+        if (dirty & studentsBit)
+        {
+            studentsContent = SerializeStudents();
+            studentsSnapshot = BuildStudentsSnapshot();
+            studentsCount = static_cast<uint32_t>(m_students.Size());
+        }
+        if (dirty & teachersBit)
+        {
+            teachersContent = SerializeTeachers();
+            teachersSnapshot = BuildTeachersSnapshot();
+            teachersCount = static_cast<uint32_t>(m_teachers.Size());
+        }
+        if (dirty & subjectsBit)
+        {
+            subjectsContent = SerializeSubjects();
+            subjectsSnapshot = BuildSubjectsSnapshot();
+            subjectsCount = static_cast<uint32_t>(m_subjects.Size());
+        }
+    }
+
+    // Знімок записується після CSV, бо зберігає відбиток вже записаного CSV-файлу
+    unsigned failed = 0;
+    if (dirty & studentsBit)
+    {
+        if (FileUtils::WriteAtomically(m_studentsFile, studentsContent))
+        {
+            Snapshot::Save(m_studentsFile, SnapshotKind::Students, studentsCount, studentsSnapshot);
+        }
+        else
+        {
+            failed |= studentsBit;
+        }
+    }
+    if (dirty & teachersBit)
+    {
+        if (FileUtils::WriteAtomically(m_teachersFile, teachersContent))
+        {
+            Snapshot::Save(m_teachersFile, SnapshotKind::Teachers, teachersCount, teachersSnapshot);
+        }
+        else
+        {
+            failed |= teachersBit;
+        }
+    }
+    if (dirty & subjectsBit)
+    {
+        if (FileUtils::WriteAtomically(m_subjectsFile, subjectsContent))
+        {
+            Snapshot::Save(m_subjectsFile, SnapshotKind::Subjects, subjectsCount, subjectsSnapshot);
+        }
+        else
+        {
+            failed |= subjectsBit;
+        }
+    }
+
+    if (failed != 0)
+    {
+        {
+            lock_guard<mutex> pendingLock(m_pendingMutex);
+            m_dirtyCollections |= failed;
+        }
+        // Збережені колекції вже містять свої зміни: у журналі залишаються
+        // лише записи колекцій, які не вдалося записати
+        vector<JournalRecord> kept;
+        for (auto& record : m_journal.ReadAll())
+        {
+            if (CollectionBit(record.collection) & failed)
+            {
+                kept.push_back(std::move(record));
+            }
+        }
+        m_journal.Rewrite(kept);
+        cerr << "Не вдалося створити контрольну точку, журнал змін збережено" << endl;
+        return false;
+    }
+    return m_journal.Truncate();
+}
+
+void DatabaseManager::SetCheckpointInterval(size_t interval)
+{
+    m_checkpointInterval = interval;
+}
+
+void DatabaseManager::SetPersistenceMode(PersistenceMode mode,
+                                         chrono::milliseconds flushWindow,
+                                         size_t flushBatchSize)
+{
+    StopFlusher();
+    if (mode == PersistenceMode::Background)
+    {
+        m_flusher = make_unique<BackgroundFlusher>([this] { return FlushPendingRecords(); },
+                                                   flushWindow, flushBatchSize);
+    }
+}
+
+void DatabaseManager::SetThreadPool(ThreadPool* threadPool)
+{
+    m_threadPool = threadPool;
+}
+
+PersistenceMode DatabaseManager::GetPersistenceMode() const
+{
+    return m_flusher ? PersistenceMode::Background : PersistenceMode::Immediate;
+}
+
+bool DatabaseManager::Flush()
+{
+    return m_flusher ? m_flusher->Flush() : true;
+}
+
+bool DatabaseManager::WaitDurable()
+{
+    return m_flusher ? m_flusher->WaitDurable(m_flusher->GetRequestedSequence()) : true;
+}
+
+void DatabaseManager::StopFlusher()
+{
+    if (m_flusher)
+    {
+        m_flusher->Flush();
+        m_flusher.reset();
+    }
+}
+
+unsigned DatabaseManager::CollectionBit(JournalCollection collection)
+{
+    return 1u << static_cast<unsigned>(collection);
 }
 
-bool DatabaseManager::LoadTeachersFromFile(const string& filename)
+void DatabaseManager::RebuildIndexes()
+{
+    m_studentSlots.Reset(m_students.Size());
+    m_teacherSlots.Reset(m_teachers.Size());
+    m_subjectSlots.Reset(m_subjects.Size());
+    RebuildSecondary(m_students, m_studentSlots, StudentIndexes());
+    RebuildSecondary(m_teachers, m_teacherSlots, TeacherIndexes());
+    RebuildSecondary(m_subjects, m_subjectSlots, SubjectIndexes());
+}
+
+size_t DatabaseManager::FindStudentPosition(const string& id) const
+{
+    return FindIndexed(m_studentIndex, id);
+}
+
+size_t DatabaseManager::FindTeacherPosition(const string& id) const
+{
+    return FindIndexed(m_teacherIndex, id);
+}
+
+size_t DatabaseManager::FindSubjectPosition(const string& id) const
+{
+    return FindIndexed(m_subjectIndex, id);
+}
+
+DatabaseManager::StudentIndexSet DatabaseManager::StudentIndexes()
+{
+    return tie(m_programIndex, m_studentNameIndex, m_studentOrder);
+}
+
+DatabaseManager::TeacherIndexSet DatabaseManager::TeacherIndexes()
+{
+    return tie(m_departmentIndex, m_teacherNameIndex, m_teacherOrder);
+}
+
+DatabaseManager::SubjectIndexSet DatabaseManager::SubjectIndexes()
+{
+    return tie(m_semesterIndex, m_subjectNameIndex, m_subjectOrder);
+}
+
+void DatabaseManager::Clear()
+{
+    lock_guard<mutex> lock(m_dataMutex);
+    m_students.Clear();
+    m_teachers.Clear();
+    m_subjects.Clear();
+    m_studentIndex.clear();
+    m_teacherIndex.clear();
+    m_subjectIndex.clear();
+    m_studentSlots.Reset(0);
+    m_teacherSlots.Reset(0);
+    m_subjectSlots.Reset(0);
+    m_programIndex.Clear();
+    m_departmentIndex.Clear();
+    m_semesterIndex.Clear();
+    m_studentNameIndex.Clear();
+    m_teacherNameIndex.Clear();
+    m_subjectNameIndex.Clear();
+    m_studentOrder.Clear();
+    m_teacherOrder.Clear();
+    m_subjectOrder.Clear();
+}
+
+void DatabaseManager::LogMutation(JournalOperation operation, JournalCollection collection,
+                                  const string& id, const string& payload)
+{
+    JournalRecord record{operation, collection, id, payload};
+
+    if (m_flusher)
+    {
+        // Фоновий режим: лише позначаємо зміну, запис виконає фоновий потік
+        {
+            lock_guard<mutex> pendingLock(m_pendingMutex);
+            m_pendingRecords.push_back(std::move(record));
+            m_dirtyCollections |= CollectionBit(collection);
+        }
+        m_flusher->NotifyMutation();
+        return;
+    }
+
+    lock_guard<mutex> lock(m_persistenceMutex);
+    {
+        lock_guard<mutex> pendingLock(m_pendingMutex);
+        m_dirtyCollections |= CollectionBit(collection);
+    }
+
+    if (!m_journal.Append(record))
+    {
+        // Журнал недоступний - зберігаємо повний стан, щоб не втратити зміну
+        CheckpointLocked();
+        return;
+    }
+
+    if (m_checkpointInterval > 0 && m_journal.GetRecordCount() >= m_checkpointInterval)
+    {
+        CheckpointLocked();
+    }
+}
+
+bool DatabaseManager::FlushPendingRecords()
 {
-    ifstream file(filename);
-    if (!file.is_open())
+    lock_guard<mutex> lock(m_persistenceMutex);
+
+    vector<JournalRecord> batch;
     {
-        cerr << "Не вдалося відкрити файл викладачів: " << filename << endl;
+        lock_guard<mutex> pendingLock(m_pendingMutex);
+        batch.swap(m_pendingRecords);
+    }
+
+    if (!m_journal.AppendBatch(batch))
+    {
+        // Журнал недоступний - зберігаємо повний стан, як і в негайному режимі
+        if (CheckpointLocked())
+        {
+            return true;
+        }
+
+        // Повертаємо записи на початок черги для повторної спроби
+        lock_guard<mutex> pendingLock(m_pendingMutex);
+        m_pendingRecords.insert(m_pendingRecords.begin(),
+                                make_move_iterator(batch.begin()), make_move_iterator(batch.end()));
         return false;
     }
 
-    m_teachers.clear();
-    string line;
-    while (getline(file, line))
+    if (m_checkpointInterval > 0 && m_journal.GetRecordCount() >= m_checkpointInterval)
     {
-        if (line.empty())
+        return CheckpointLocked();
+    }
+    return true;
+}
+
+void DatabaseManager::ReplayJournal()
+{
+    bool damaged = false;
+    vector<JournalRecord> records = m_journal.ReadAll(&damaged);
+    for (const auto& record : records)
+    {
+        try
+        {
+            ApplyJournalRecord(record);
+        }
+        catch (const exception& e)
         {
-            continue;
+            cerr << "Помилка відтворення запису журналу " << record.id << ": " << e.what() << endl;
         }
+    }
+    m_journal.SetRecordCount(records.size());
+
+    // Недописаний рядок залишився б у файлі, і наступний запис склеївся б із ним
+    // (незакрита лапка поглинула б усі подальші записи), тому журнал
+    // перезаписується лише коректними записами
+    if (damaged)
+    {
+        m_journal.Rewrite(records);
+    }
+}
 
-        stringstream ss(line);
-        string id, name, lastName, department, degreeStr, email;
+void DatabaseManager::ApplyJournalRecord(const JournalRecord& record)
+{
+    // Відтворені зміни ще не потрапили в CSV, тож колекція вважається зміненою
+    {
+        lock_guard<mutex> pendingLock(m_pendingMutex);
+        m_dirtyCollections |= CollectionBit(record.collection);
+    }
 
-        if (getline(ss, id, ',') && getline(ss, name, ',') &&
-            getline(ss, lastName, ',') && getline(ss, department, ',') &&
-            getline(ss, degreeStr, ',') && getline(ss, email))
+    // Кожна операція перевіряє, чи її результат уже є в колекції (див. ReplayUpsert),
+    // тому повторне відтворення журналу поверх тих самих CSV не дублює записи
+    switch (record.collection)
+    {
+        case JournalCollection::Students:
         {
-            try
+            size_t position = FindStudentPosition(record.id);
+            if (record.operation == JournalOperation::Delete)
             {
-                int degreeInt = stoi(degreeStr);
-                AcademicDegree degree = static_cast<AcademicDegree>(degreeInt);
-                m_teachers.push_back(Teacher(name, lastName, email, id, department, degree));
+                if (position != NOT_FOUND)
+                {
+                    EraseIndexed(m_students, m_studentIndex, m_studentSlots, position, StudentIndexes());
+                }
+                break;
             }
-            catch (const exception& e)
+            Student student;
+            if (!ParseStudentRecord(record.payload, student))
+            {
+                break;
+            }
+            ReplayUpsert(m_students, m_studentIndex, m_studentSlots, record.operation, record.id,
+                         student, StudentIndexes());
+            break;
+        }
+        case JournalCollection::Teachers:
+        {
+            size_t position = FindTeacherPosition(record.id);
+            if (record.operation == JournalOperation::Delete)
+            {
+                if (position != NOT_FOUND)
+                {
+                    EraseIndexed(m_teachers, m_teacherIndex, m_teacherSlots, position, TeacherIndexes());
+                }
+                break;
+            }
+            Teacher teacher;
+            if (!ParseTeacherRecord(record.payload, teacher))
+            {
+                break;
+            }
+            ReplayUpsert(m_teachers, m_teacherIndex, m_teacherSlots, record.operation, record.id,
+                         teacher, TeacherIndexes());
+            break;
+        }
+        case JournalCollection::Subjects:
+        {
+            size_t position = FindSubjectPosition(record.id);
+            if (record.operation == JournalOperation::Delete)
+            {
+                if (position != NOT_FOUND)
+                {
+                    EraseIndexed(m_subjects, m_subjectIndex, m_subjectSlots, position, SubjectIndexes());
+                }
+                break;
+            }
+            Subject subject;
+            if (!ParseSubjectRecord(record.payload, subject))
             {
-                cerr << "Помилка парсингу даних викладача: " << e.what() << endl;
+                break;
             }
+            ReplayUpsert(m_subjects, m_subjectIndex, m_subjectSlots, record.operation, record.id,
+                         subject, SubjectIndexes());
+            break;
         }
     }
+}
+
+string DatabaseManager::FormatStudentRecord(const Student& student)
+{
+    string line;
+    CsvWriter::AppendField(line, student.getStudentID());
+    line += ',';
+    CsvWriter::AppendField(line, student.getName());
+    line += ',';
+    CsvWriter::AppendField(line, student.getLastName());
+    line += ',';
+    CsvWriter::AppendField(line, student.getEducationalProgram());
+    line += ',';
+    CsvWriter::AppendField(line, student.getEmail());
+    return line;
+}
+
+string DatabaseManager::FormatTeacherRecord(const Teacher& teacher)
+{
+    string line;
+    CsvWriter::AppendField(line, teacher.getTeacherID());
+    line += ',';
+    CsvWriter::AppendField(line, teacher.getName());
+    line += ',';
+    CsvWriter::AppendField(line, teacher.getLastName());
+    line += ',';
+    CsvWriter::AppendField(line, teacher.getDepartment());
+    line += ',';
+    line += to_string(static_cast<int>(teacher.getAcademicDegree()));
+    line += ',';
+    CsvWriter::AppendField(line, teacher.getEmail());
+    return line;
+}
+
+string DatabaseManager::FormatSubjectRecord(const Subject& subject)
+{
+    string line;
+    CsvWriter::AppendField(line, subject.getSubjectId());
+    line += ',';
+    CsvWriter::AppendField(line, subject.getSubjectName());
+    line += ',';
+    line += to_string(subject.getEctsCredits());
+    line += ',';
+    line += to_string(subject.getSemester());
+    line += ',';
+    CsvWriter::AppendField(line, subject.getTeacherId());
+    return line;
+}
+
+bool DatabaseManager::ParseStudentRecord(string_view line, Student& student)
+{
+    CsvReader reader(line);
+    return reader.Next() && ParseStudentFields(reader.GetFields(), student);
+}
+
+bool DatabaseManager::ParseTeacherRecord(string_view line, Teacher& teacher)
+{
+    CsvReader reader(line);
+    return reader.Next() && ParseTeacherFields(reader.GetFields(), teacher);
+}
+
+bool DatabaseManager::ParseSubjectRecord(string_view line, Subject& subject)
+{
+    CsvReader reader(line);
+    return reader.Next() && ParseSubjectFields(reader.GetFields(), subject);
+}
+
+bool DatabaseManager::ParseStudentFields(const vector<string_view>& fields, Student& student)
+{
+    if (fields.size() != 5)
+    {
+        return false;
+    }
 
-    file.close();
+    student = Student(string(fields[1]), string(fields[2]), string(fields[4]),
+                      string(fields[0]), string(fields[3]));
     return true;
 }
 
-bool DatabaseManager::LoadSubjectsFromFile(const string& filename)
+bool DatabaseManager::ParseTeacherFields(const vector<string_view>& fields, Teacher& teacher)
 {
-    ifstream file(filename);
-    if (!file.is_open())
+    if (fields.size() != 6)
     {
-        cerr << "Не вдалося відкрити файл предметів: " << filename << endl;
         return false;
     }
 
-    m_subjects.clear();
-    string line;
-    while (getline(file, line))
+    AcademicDegree degree = static_cast<AcademicDegree>(ParseInt(fields[4]));
+    teacher = Teacher(string(fields[1]), string(fields[2]), string(fields[5]),
+                      string(fields[0]), string(fields[3]), degree);
+    return true;
+}
+
+bool DatabaseManager::ParseSubjectFields(const vector<string_view>& fields, Subject& subject)
+{
+    if (fields.size() != 5)
     {
-        if (line.empty())
-        {
-            continue;
-        }
+        return false;
+    }
 
-        stringstream ss(line);
-        string id, name, creditsStr, semesterStr, teacherId;
+    int credits = ParseInt(fields[2]);
+    int semester = ParseInt(fields[3]);
+    subject = Subject(string(fields[0]), string(fields[1]), credits, string(fields[4]), semester);
+    return true;
+}
 
-        if (getline(ss, id, ',') && getline(ss, name, ',') &&
-            getline(ss, creditsStr, ',') && getline(ss, semesterStr, ',') &&
-            getline(ss, teacherId))
-        {
-            try
-            {
-                int credits = stoi(creditsStr);
-                int semester = stoi(semesterStr);
-                m_subjects.push_back(Subject(id, name, credits, teacherId, semester));
-            }
-            catch (const exception& e)
-            {
-                cerr << "Помилка парсингу даних предмета: " << e.what() << endl;
-            }
-        }
+bool DatabaseManager::LoadStudentsFromFile(const string& filename)
+{
+    if (LoadStudentsFromSnapshot(filename))
+    {
+        return true;
+    }
+
+    MappedFile file;
+    if (!file.Open(filename))
+    {
+        cerr << "Не вдалося відкрити файл студентів: " + filename + "\n";
+        return false;
     }
 
-    file.close();
+    LoadRecordsParallel(m_threadPool, file.GetView(), m_students, m_studentIndex,
+                        &DatabaseManager::ParseStudentFields, "студента");
+
+    file.Close();
+    Snapshot::Save(filename, SnapshotKind::Students,
+                   static_cast<uint32_t>(m_students.Size()), BuildStudentsSnapshot());
     return true;
 }
 
-bool DatabaseManager::SaveStudentsToFile(const string& filename) const
+bool DatabaseManager::LoadTeachersFromFile(const string& filename)
 {
-    ofstream file(filename);
-    if (!file.is_open())
+    if (LoadTeachersFromSnapshot(filename))
+    {
+        return true;
+    }
+
+    MappedFile file;
+    if (!file.Open(filename))
     {
-        cerr << "Не вдалося відкрити файл для збереження студентів: " << filename << endl;
+        cerr << "Не вдалося відкрити файл викладачів: " + filename + "\n";
         return false;
     }
 
-    for (const auto& student : m_students)
+    LoadRecordsParallel(m_threadPool, file.GetView(), m_teachers, m_teacherIndex,
+                        &DatabaseManager::ParseTeacherFields, "викладача");
+
+    file.Close();
+    Snapshot::Save(filename, SnapshotKind::Teachers,
+                   static_cast<uint32_t>(m_teachers.Size()), BuildTeachersSnapshot());
+    return true;
+}
+
+bool DatabaseManager::LoadSubjectsFromFile(const string& filename)
+{
+    if (LoadSubjectsFromSnapshot(filename))
+    {
+        return true;
+    }
+
+    MappedFile file;
+    if (!file.Open(filename))
     {
-        file << student.getStudentID() << ","
-             << student.getName() << ","
-             << student.getLastName() << ","
-             << student.getEducationalProgram() << ","
-             << student.getEmail() << endl;
+        cerr << "Не вдалося відкрити файл предметів: " + filename + "\n";
+        return false;
     }
 
-    file.close();
+    LoadRecordsParallel(m_threadPool, file.GetView(), m_subjects, m_subjectIndex,
+                        &DatabaseManager::ParseSubjectFields, "предмета");
+
+    file.Close();
+    Snapshot::Save(filename, SnapshotKind::Subjects,
+                   static_cast<uint32_t>(m_subjects.Size()), BuildSubjectsSnapshot());
+    return true;
+}
+
+bool DatabaseManager::SaveStudentsToFile(const string& filename) const
+{
+    if (!FileUtils::WriteAtomically(filename, SerializeStudents()))
+    {
+        cerr << "Не вдалося зберегти студентів у файл: " << filename << endl;
+        return false;
+    }
     return true;
 }
 
 bool DatabaseManager::SaveTeachersToFile(const string& filename) const
 {
-    ofstream file(filename);
-    if (!file.is_open())
+    if (!FileUtils::WriteAtomically(filename, SerializeTeachers()))
+    {
+        cerr << "Не вдалося зберегти викладачів у файл: " << filename << endl;
+        return false;
+    }
+    return true;
+}
+
+bool DatabaseManager::SaveSubjectsToFile(const string& filename) const
+{
+    if (!FileUtils::WriteAtomically(filename, SerializeSubjects()))
+    {
+        cerr << "Не вдалося зберегти предмети у файл: " << filename << endl;
+        return false;
+    }
+    return true;
+}
+
+string DatabaseManager::SerializeStudents() const
+{
+    string content;
+    for (size_t i = 0; i < m_students.Size(); i++)
+    {
+        const auto& row = m_students.GetRow(i);
+        CsvWriter::AppendField(content, m_students.GetId(i));
+        content += ',';
+        CsvWriter::AppendField(content, m_students.GetText(row.name));
+        content += ',';
+        CsvWriter::AppendField(content, m_students.GetText(row.lastName));
+        content += ',';
+        CsvWriter::AppendField(content, row.program.GetText());
+        content += ',';
+        CsvWriter::AppendField(content, m_students.GetText(row.email));
+        content += '\n';
+    }
+    return content;
+}
+
+string DatabaseManager::SerializeTeachers() const
+{
+    string content;
+    for (size_t i = 0; i < m_teachers.Size(); i++)
+    {
+        const auto& row = m_teachers.GetRow(i);
+        CsvWriter::AppendField(content, m_teachers.GetId(i));
+        content += ',';
+        CsvWriter::AppendField(content, m_teachers.GetText(row.name));
+        content += ',';
+        CsvWriter::AppendField(content, m_teachers.GetText(row.lastName));
+        content += ',';
+        CsvWriter::AppendField(content, row.department.GetText());
+        content += ',';
+        content += to_string(static_cast<int>(row.degree));
+        content += ',';
+        CsvWriter::AppendField(content, m_teachers.GetText(row.email));
+        content += '\n';
+    }
+    return content;
+}
+
+string DatabaseManager::SerializeSubjects() const
+{
+    string content;
+    for (size_t i = 0; i < m_subjects.Size(); i++)
+    {
+        const auto& row = m_subjects.GetRow(i);
+        CsvWriter::AppendField(content, m_subjects.GetId(i));
+        content += ',';
+        CsvWriter::AppendField(content, m_subjects.GetText(row.name));
+        content += ',';
+        content += to_string(row.credits);
+        content += ',';
+        content += to_string(row.semester);
+        content += ',';
+        CsvWriter::AppendField(content, row.teacherId.GetText());
+        content += '\n';
+    }
+    return content;
+}
+
+bool DatabaseManager::LoadStudentsFromSnapshot(const string& filename)
+{
+    string content;
+    size_t offset;
+    uint32_t count;
+    if (!Snapshot::Load(filename, SnapshotKind::Students, content, offset, count))
     {
-        cerr << "Не вдалося відкрити файл для збереження викладачів: " << filename << endl;
         return false;
     }
 
-    for (const auto& teacher : m_teachers)
+    SnapshotReader reader(content, offset);
+    vector<Symbol> symbols;
+    if (!SymbolTable::ReadFrom(reader, symbols))
+    {
+        return false;
+    }
+    RecordTable<Student> students;
+    students.Reserve(count);
+    for (uint32_t i = 0; i < count && !reader.HasFailed(); i++)
+    {
+        string id = reader.ReadString();
+        string name = reader.ReadString();
+        string lastName = reader.ReadString();
+        Symbol program;
+        if (!ReadSymbol(reader, symbols, program))
+        {
+            return false;
+        }
+        string email = reader.ReadString();
+        students.Append(Student(TrustedData{}, name, lastName, email, id, program.GetText()));
+    }
+    if (reader.HasFailed())
     {
-        file << teacher.getTeacherID() << ","
-             << teacher.getName() << ","
-             << teacher.getLastName() << ","
-             << teacher.getDepartment() << ","
-             << static_cast<int>(teacher.getAcademicDegree()) << ","
-             << teacher.getEmail() << endl;
+        return false;
     }
 
-    file.close();
+    m_students = std::move(students);
+    RebuildIndex(m_students, m_studentIndex);
     return true;
 }
 
-bool DatabaseManager::SaveSubjectsToFile(const string& filename) const
+bool DatabaseManager::LoadTeachersFromSnapshot(const string& filename)
+{
+    string content;
+    size_t offset;
+    uint32_t count;
+    if (!Snapshot::Load(filename, SnapshotKind::Teachers, content, offset, count))
+    {
+        return false;
+    }
+
+    SnapshotReader reader(content, offset);
+    vector<Symbol> symbols;
+    if (!SymbolTable::ReadFrom(reader, symbols))
+    {
+        return false;
+    }
+    RecordTable<Teacher> teachers;
+    teachers.Reserve(count);
+    for (uint32_t i = 0; i < count && !reader.HasFailed(); i++)
+    {
+        string id = reader.ReadString();
+        string name = reader.ReadString();
+        string lastName = reader.ReadString();
+        Symbol department;
+        if (!ReadSymbol(reader, symbols, department))
+        {
+            return false;
+        }
+        AcademicDegree degree = static_cast<AcademicDegree>(reader.ReadInt32());
+        string email = reader.ReadString();
+        teachers.Append(Teacher(TrustedData{}, name, lastName, email, id, department.GetText(), degree));
+    }
+    if (reader.HasFailed())
+    {
+        return false;
+    }
+
+    m_teachers = std::move(teachers);
+    RebuildIndex(m_teachers, m_teacherIndex);
+    return true;
+}
+
+bool DatabaseManager::LoadSubjectsFromSnapshot(const string& filename)
 {
-    ofstream file(filename);
-    if (!file.is_open())
+    string content;
+    size_t offset;
+    uint32_t count;
+    if (!Snapshot::Load(filename, SnapshotKind::Subjects, content, offset, count))
     {
-        cerr << "Не вдалося відкрити файл для збереження предметів: " << filename << endl;
         return false;
     }
 
-    for (const auto& subject : m_subjects)
+    SnapshotReader reader(content, offset);
+    vector<Symbol> symbols;
+    if (!SymbolTable::ReadFrom(reader, symbols))
+    {
+        return false;
+    }
+    RecordTable<Subject> subjects;
+    subjects.Reserve(count);
+    for (uint32_t i = 0; i < count && !reader.HasFailed(); i++)
+    {
+        string id = reader.ReadString();
+        string name = reader.ReadString();
+        int credits = reader.ReadInt32();
+        int semester = reader.ReadInt32();
+        Symbol teacherId;
+        if (!ReadSymbol(reader, symbols, teacherId))
+        {
+            return false;
+        }
+        subjects.Append(Subject(TrustedData{}, id, name, credits, teacherId.GetText(), semester));
+    }
+    if (reader.HasFailed())
     {
-        file << subject.getSubjectId() << ","
-             << subject.getSubjectName() << ","
-             << subject.getEctsCredits() << ","
-             << subject.getSemester() << ","
-             << subject.getTeacherId() << endl;
+        return false;
     }
 
-    file.close();
+    m_subjects = std::move(subjects);
+    RebuildIndex(m_subjects, m_subjectIndex);
     return true;
 }
 
+string DatabaseManager::BuildStudentsSnapshot() const
+{
+    SymbolSubset symbols;
+    for (size_t i = 0; i < m_students.Size(); i++)
+    {
+        symbols.Add(m_students.GetRow(i).program);
+    }
+    SnapshotWriter writer;
+    symbols.WriteTo(writer);
+    for (size_t i = 0; i < m_students.Size(); i++)
+    {
+        const auto& row = m_students.GetRow(i);
+        writer.WriteString(m_students.GetId(i));
+        writer.WriteString(m_students.GetText(row.name));
+        writer.WriteString(m_students.GetText(row.lastName));
+        writer.WriteUInt32(symbols.Encode(row.program));
+        writer.WriteString(m_students.GetText(row.email));
+    }
+    return writer.GetBuffer();
+}
+
+string DatabaseManager::BuildTeachersSnapshot() const
+{
+    SymbolSubset symbols;
+    for (size_t i = 0; i < m_teachers.Size(); i++)
+    {
+        symbols.Add(m_teachers.GetRow(i).department);
+    }
+    SnapshotWriter writer;
+    symbols.WriteTo(writer);
+    for (size_t i = 0; i < m_teachers.Size(); i++)
+    {
+        const auto& row = m_teachers.GetRow(i);
+        writer.WriteString(m_teachers.GetId(i));
+        writer.WriteString(m_teachers.GetText(row.name));
+        writer.WriteString(m_teachers.GetText(row.lastName));
+        writer.WriteUInt32(symbols.Encode(row.department));
+        writer.WriteInt32(static_cast<int32_t>(row.degree));
+        writer.WriteString(m_teachers.GetText(row.email));
+    }
+    return writer.GetBuffer();
+}
+
+string DatabaseManager::BuildSubjectsSnapshot() const
+{
+    SymbolSubset symbols;
+    for (size_t i = 0; i < m_subjects.Size(); i++)
+    {
+        symbols.Add(m_subjects.GetRow(i).teacherId);
+    }
+    SnapshotWriter writer;
+    symbols.WriteTo(writer);
+    for (size_t i = 0; i < m_subjects.Size(); i++)
+    {
+        const auto& row = m_subjects.GetRow(i);
+        writer.WriteString(m_subjects.GetId(i));
+        writer.WriteString(m_subjects.GetText(row.name));
+        writer.WriteInt32(row.credits);
+        writer.WriteInt32(row.semester);
+        writer.WriteUInt32(symbols.Encode(row.teacherId));
+    }
+    return writer.GetBuffer();
+}
+
 } // namespace University
\ No newline at end of file
@@ -9,11 +9,49 @@
 #include "Student.h"
 #include "Teacher.h"
 #include "Subject.h"
+#include "EntityRows.h"
+#include "Journal.h"
+#include "BackgroundFlusher.h"
+#include "ThreadPool.h"
+#include "FileConstants.h"
+#include "Snapshot.h"
+#include "LoadState.h"
+#include "SlotMap.h"
+#include "ValueIndex.h"
+#include "TrigramIndex.h"
+#include "OrderedIndex.h"
+#include "RecordView.h"
+#include "Query.h"
 #include <vector>
 #include <string>
+#include <string_view>
+#include <memory>
+#include <unordered_map>
+#include <mutex>
+#include <chrono>
+#include <functional>
+#include <optional>
+#include <tuple>
 
 namespace University {
 
+/**
+ * @enum PersistenceMode
+ * @brief Режим збереження змін бази даних
+ */
+enum class PersistenceMode {
+    Immediate,   ///< Кожна мутація синхронно записується в журнал
+    Background   ///< Мутації групуються та зберігаються фоновим потоком
+};
+
+using StudentHandle = Handle<Student>;  ///< Дескриптор студента
+using TeacherHandle = Handle<Teacher>;  ///< Дескриптор викладача
+using SubjectHandle = Handle<Subject>;  ///< Дескриптор предмета
+
+using StudentView = RecordView<Student>;  ///< Представлення студентів
+using TeacherView = RecordView<Teacher>;  ///< Представлення викладачів
+using SubjectView = RecordView<Subject>;  ///< Представлення предметів
+
 /**
  * @class DatabaseManager
  * @brief Менеджер бази даних університету
@@ -21,46 +59,89 @@ namespace University {
  * Відповідає за управління студентами, викладачами та предметами,
  * включаючи операції додавання, редагування, видалення, пошуку,
  * фільтрації та сортування даних.
+ *
+ * Колекції зберігаються плоскими рядками (див. RecordTable, EntityRows.h),
+ * а об'єкти Student, Teacher і Subject створюються лише під час видачі
+ * записів назовні: методами Get*, GetAll* та через представлення.
  */
 class DatabaseManager {
-public:
-    std::vector<Student> m_students;      ///< Список студентів
-    std::vector<Teacher> m_teachers;      ///< Список викладачів
-    std::vector<Subject> m_subjects;      ///< Список предметів
+private:
+    RecordTable<Student> m_students;      ///< Студенти
+    RecordTable<Teacher> m_teachers;      ///< Викладачі
+    RecordTable<Subject> m_subjects;      ///< Предмети
+    std::unordered_map<std::string, size_t> m_studentIndex;  ///< ID студента -> позиція в m_students
+    std::unordered_map<std::string, size_t> m_teacherIndex;  ///< ID викладача -> позиція в m_teachers
+    std::unordered_map<std::string, size_t> m_subjectIndex;  ///< ID предмета -> позиція в m_subjects
+    SlotMap<Student> m_studentSlots;      ///< Дескриптори студентів -> позиції в m_students
+    SlotMap<Teacher> m_teacherSlots;      ///< Дескриптори викладачів -> позиції в m_teachers
+    SlotMap<Subject> m_subjectSlots;      ///< Дескриптори предметів -> позиції в m_subjects
+    ValueIndex<Symbol, Student> m_programIndex{&DatabaseManager::ProgramKey};           ///< Програма -> студенти
+    ValueIndex<Symbol, Teacher> m_departmentIndex{&DatabaseManager::DepartmentKey};     ///< Кафедра -> викладачі
+    ValueIndex<int, Subject> m_semesterIndex{&DatabaseManager::SemesterKey};            ///< Семестр -> предмети
+    TrigramIndex<Student> m_studentNameIndex{&DatabaseManager::StudentNameKey};  ///< Триграми імен студентів
+    TrigramIndex<Teacher> m_teacherNameIndex{&DatabaseManager::TeacherNameKey};  ///< Триграми імен викладачів
+    TrigramIndex<Subject> m_subjectNameIndex{&DatabaseManager::SubjectNameKey};  ///< Триграми назв предметів
+    OrderedIndex<Student> m_studentOrder{[this](StudentHandle left, StudentHandle right)
+        { return CompareStudentOrder(left, right); }};  ///< Студенти за повним іменем
+    OrderedIndex<Teacher> m_teacherOrder{[this](TeacherHandle left, TeacherHandle right)
+        { return CompareTeacherOrder(left, right); }};  ///< Викладачі за повним іменем
+    OrderedIndex<Subject> m_subjectOrder{[this](SubjectHandle left, SubjectHandle right)
+        { return CompareSubjectOrder(left, right); }};  ///< Предмети за назвою
+
+    std::string m_studentsFile;           ///< Файл студентів
+    std::string m_teachersFile;           ///< Файл викладачів
+    std::string m_subjectsFile;           ///< Файл предметів
+    Journal m_journal;                    ///< Журнал змін між контрольними точками
+    size_t m_checkpointInterval;          ///< Кількість записів журналу до контрольної точки
+    LoadState m_loadState;                ///< Стан завантаження (захищений m_persistenceMutex)
+
+    std::mutex m_dataMutex;               ///< Захищає колекції від читання фоновим потоком під час змін
+    mutable std::mutex m_persistenceMutex; ///< Серіалізує доступ до журналу та файлів
+    std::mutex m_pendingMutex;            ///< Захищає чергу незбережених записів
+    std::vector<JournalRecord> m_pendingRecords;   ///< Записи, що очікують групового збереження
+    unsigned m_dirtyCollections;          ///< Бітова маска колекцій, змінених після контрольної точки
+    std::unique_ptr<BackgroundFlusher> m_flusher;  ///< Фоновий потік (лише в режимі Background)
+    ThreadPool* m_threadPool;             ///< Спільний пул потоків для повного перегляду (nullptr - послідовно)
+
+    static const size_t DEFAULT_CHECKPOINT_INTERVAL = 1000; ///< Інтервал контрольних точок за замовчуванням
+    static const size_t DEFAULT_FLUSH_BATCH_SIZE = 100;     ///< Кількість змін, що запускає збереження негайно
+    static constexpr std::chrono::milliseconds DEFAULT_FLUSH_WINDOW{200}; ///< Вікно групування змін
+    static const size_t DEFAULT_FUZZY_DISTANCE = 2;          ///< Відстань редагування нечіткого пошуку за замовчуванням
 
 public:
     // === КОНСТРУКТОРИ ТА ДЕСТРУКТОР ===
 
     /**
      * @brief Конструктор за замовчуванням
-     * @details Завантажує дані з файлів за замовчуванням
+     * @details Створює порожню базу з файлами за замовчуванням; дані завантажує Open()
      */
     DatabaseManager();
 
     /**
      * @brief Конструктор з вказанням файлів
+     * @details Створює порожню базу; дані завантажує Open()
      * @param studentsFile Шлях до файлу студентів
      * @param teachersFile Шлях до файлу викладачів
      * @param subjectsFile Шлях до файлу предметів
+     * @param journalFile Шлях до журналу змін
      */
     DatabaseManager(const std::string& studentsFile,
                    const std::string& teachersFile,
-                   const std::string& subjectsFile);
+                   const std::string& subjectsFile,
+                   const std::string& journalFile = FileConstants::JOURNAL_FILE);
 
-    /**
-     * @brief Конструктор копіювання
-     * @param other Об'єкт для копіювання
-     */
-    DatabaseManager(const DatabaseManager& other);
-
-    /**
-     * @brief Конструктор переміщення
-     * @param other Об'єкт для переміщення
-     */
-    DatabaseManager(DatabaseManager&& other) noexcept;
+    // Менеджер володіє журналом і фоновим потоком: копія дописувала б у той самий
+    // журнал і очищала б його у своєму деструкторі, тож копіювання заборонено.
+    // Переміщення теж заборонено: фоновий потік, незаписані записи журналу та
+    // представлення записів (RecordView) прив'язані до цього об'єкта
+    DatabaseManager(const DatabaseManager&) = delete;
+    DatabaseManager& operator=(const DatabaseManager&) = delete;
+    DatabaseManager(DatabaseManager&&) = delete;
+    DatabaseManager& operator=(DatabaseManager&&) = delete;
 
     /**
      * @brief Деструктор
+     * @details Переносить незбережені записи журналу в CSV-файли
      */
     ~DatabaseManager();
 
@@ -75,9 +156,25 @@ public:
     /**
      * @brief Знаходить студента за ID
      * @param id ID студента
-     * @return Вказівник на студента або nullptr, якщо не знайдено
+     * @return Копія даних студента або std::nullopt, якщо не знайдено
      */
-    Student* GetStudent(const std::string& id);
+    std::optional<Student> GetStudent(const std::string& id);
+
+    /**
+     * @brief Повертає стабільний дескриптор студента за ID
+     * @details Дескриптор залишається дійсним після додавання, видалення інших
+     * записів і сортування, доки сам запис не видалено
+     * @param id ID студента
+     * @return Дескриптор або порожній дескриптор, якщо не знайдено
+     */
+    StudentHandle GetStudentHandle(const std::string& id);
+
+    /**
+     * @brief Знаходить студента за дескриптором за O(1)
+     * @param handle Дескриптор студента
+     * @return Копія даних студента або std::nullopt, якщо запис видалено
+     */
+    std::optional<Student> GetStudent(StudentHandle handle);
 
     /**
      * @brief Додає нового студента
@@ -94,6 +191,14 @@ public:
      */
     bool EditStudent(const std::string& id, const Student& updatedStudent);
 
+    /**
+     * @brief Редагує дані студента за дескриптором без повторного пошуку за ID
+     * @param handle Дескриптор студента
+     * @param updatedStudent Оновлені дані студента
+     * @return true якщо успішно, false якщо запис видалено
+     */
+    bool EditStudent(StudentHandle handle, const Student& updatedStudent);
+
     /**
      * @brief Видаляє студента
      * @param id ID студента для видалення
@@ -112,9 +217,25 @@ public:
     /**
      * @brief Знаходить викладача за ID
      * @param id ID викладача
-     * @return Вказівник на викладача або nullptr, якщо не знайдено
+     * @return Копія даних викладача або std::nullopt, якщо не знайдено
      */
-    Teacher* GetTeacher(const std::string& id);
+    std::optional<Teacher> GetTeacher(const std::string& id);
+
+    /**
+     * @brief Повертає стабільний дескриптор викладача за ID
+     * @details Дескриптор залишається дійсним після додавання, видалення інших
+     * записів і сортування, доки сам запис не видалено
+     * @param id ID викладача
+     * @return Дескриптор або порожній дескриптор, якщо не знайдено
+     */
+    TeacherHandle GetTeacherHandle(const std::string& id);
+
+    /**
+     * @brief Знаходить викладача за дескриптором за O(1)
+     * @param handle Дескриптор викладача
+     * @return Копія даних викладача або std::nullopt, якщо запис видалено
+     */
+    std::optional<Teacher> GetTeacher(TeacherHandle handle);
 
     /**
      * @brief Додає нового викладача
@@ -131,6 +252,14 @@ public:
      */
     bool EditTeacher(const std::string& id, const Teacher& updatedTeacher);
 
+    /**
+     * @brief Редагує дані викладача за дескриптором без повторного пошуку за ID
+     * @param handle Дескриптор викладача
+     * @param updatedTeacher Оновлені дані викладача
+     * @return true якщо успішно, false якщо запис видалено
+     */
+    bool EditTeacher(TeacherHandle handle, const Teacher& updatedTeacher);
+
     /**
      * @brief Видаляє викладача
      * @param id ID викладача для видалення
@@ -149,9 +278,25 @@ public:
     /**
      * @brief Знаходить предмет за ID
      * @param id ID предмета
-     * @return Вказівник на предмет або nullptr, якщо не знайдено
+     * @return Копія даних предмета або std::nullopt, якщо не знайдено
+     */
+    std::optional<Subject> GetSubject(const std::string& id);
+
+    /**
+     * @brief Повертає стабільний дескриптор предмета за ID
+     * @details Дескриптор залишається дійсним після додавання, видалення інших
+     * записів і сортування, доки сам запис не видалено
+     * @param id ID предмета
+     * @return Дескриптор або порожній дескриптор, якщо не знайдено
      */
-    Subject* GetSubject(const std::string& id);
+    SubjectHandle GetSubjectHandle(const std::string& id);
+
+    /**
+     * @brief Знаходить предмет за дескриптором за O(1)
+     * @param handle Дескриптор предмета
+     * @return Копія даних предмета або std::nullopt, якщо запис видалено
+     */
+    std::optional<Subject> GetSubject(SubjectHandle handle);
 
     /**
      * @brief Додає новий предмет
@@ -168,6 +313,14 @@ public:
      */
     bool EditSubject(const std::string& id, const Subject& updatedSubject);
 
+    /**
+     * @brief Редагує дані предмета за дескриптором без повторного пошуку за ID
+     * @param handle Дескриптор предмета
+     * @param updatedSubject Оновлені дані предмета
+     * @return true якщо успішно, false якщо запис видалено
+     */
+    bool EditSubject(SubjectHandle handle, const Subject& updatedSubject);
+
     /**
      * @brief Видаляє предмет
      * @param id ID предмета для видалення
@@ -221,6 +374,164 @@ public:
      */
     std::vector<Subject> FilterSubjectsBySemester(int semester) const;
 
+    // === ПРЕДСТАВЛЕННЯ ===
+    // Представлення посилаються на таблиці колекцій і дійсні до наступної зміни
+    // відповідної колекції. Page() дає сторінку результату без копіювання списку
+    // позицій, а кожне звернення до запису декодує його з рядка таблиці.
+
+    /**
+     * @brief Представлення всіх студентів
+     */
+    StudentView ViewAllStudents() const;
+
+    /**
+     * @brief Представлення всіх викладачів
+     */
+    TeacherView ViewAllTeachers() const;
+
+    /**
+     * @brief Представлення всіх предметів
+     */
+    SubjectView ViewAllSubjects() const;
+
+    /**
+     * @brief Пошук студентів за іменем (нечутливий до регістру)
+     * @param name Ім'я для пошуку
+     * @return Представлення знайдених студентів у порядку колекції
+     */
+    StudentView ViewStudentsByName(const std::string& name) const;
+
+    /**
+     * @brief Пошук викладачів за іменем (нечутливий до регістру)
+     * @param name Ім'я для пошуку
+     * @return Представлення знайдених викладачів у порядку колекції
+     */
+    TeacherView ViewTeachersByName(const std::string& name) const;
+
+    /**
+     * @brief Пошук предметів за назвою (нечутливий до регістру)
+     * @param name Назва для пошуку
+     * @return Представлення знайдених предметів у порядку колекції
+     */
+    SubjectView ViewSubjectsByName(const std::string& name) const;
+
+    /**
+     * @brief Нечіткий пошук студентів за ім'ям
+     * @details Знаходить імена, частина яких відрізняється від запиту не більше
+     * ніж на maxDistance вставок, видалень чи замін літер (але не більше
+     * третини довжини запиту). Кандидати відбираються триграмним індексом.
+     * @param name Ім'я, можливо з помилками
+     * @param maxDistance Найбільша відстань редагування
+     * @return Представлення студентів, впорядковане від найближчих
+     */
+    StudentView ViewStudentsByNameFuzzy(const std::string& name,
+                                        size_t maxDistance = DEFAULT_FUZZY_DISTANCE) const;
+
+    /**
+     * @brief Нечіткий пошук викладачів за ім'ям
+     * @param name Ім'я, можливо з помилками
+     * @param maxDistance Найбільша відстань редагування
+     * @return Представлення викладачів, впорядковане від найближчих
+     */
+    TeacherView ViewTeachersByNameFuzzy(const std::string& name,
+                                        size_t maxDistance = DEFAULT_FUZZY_DISTANCE) const;
+
+    /**
+     * @brief Нечіткий пошук предметів за назвою
+     * @param name Назва, можливо з помилками
+     * @param maxDistance Найбільша відстань редагування
+     * @return Представлення предметів, впорядковане від найближчих
+     */
+    SubjectView ViewSubjectsByNameFuzzy(const std::string& name,
+                                        size_t maxDistance = DEFAULT_FUZZY_DISTANCE) const;
+
+    /**
+     * @brief Фільтрація студентів за освітньою програмою
+     * @param program Освітня програма для фільтрації
+     * @return Представлення відфільтрованих студентів
+     */
+    StudentView ViewStudentsByProgram(const std::string& program) const;
+
+    /**
+     * @brief Фільтрація викладачів за кафедрою
+     * @param department Кафедра для фільтрації
+     * @return Представлення відфільтрованих викладачів
+     */
+    TeacherView ViewTeachersByDepartment(const std::string& department) const;
+
+    /**
+     * @brief Фільтрація предметів за семестром
+     * @param semester Семестр для фільтрації
+     * @return Представлення відфільтрованих предметів
+     */
+    SubjectView ViewSubjectsBySemester(int semester) const;
+
+    // === ПЕРШІ ЗАПИСИ ЗА ПОРЯДКОМ ===
+
+    /**
+     * @brief Повертає перших count студентів у порядку імені
+     * @details Впорядкований індекс обходиться лише до count-го запису,
+     * тож перша сторінка великої колекції не потребує повного сортування.
+     * @param count Кількість студентів
+     * @param ascending true - за зростанням, false - за спаданням
+     * @return Представлення не більше ніж count студентів
+     */
+    StudentView ViewTopStudentsByName(size_t count, bool ascending = true) const;
+
+    /**
+     * @brief Повертає перших count викладачів у порядку імені
+     * @param count Кількість викладачів
+     * @param ascending true - за зростанням, false - за спаданням
+     * @return Представлення не більше ніж count викладачів
+     */
+    TeacherView ViewTopTeachersByName(size_t count, bool ascending = true) const;
+
+    /**
+     * @brief Повертає перші count предметів у порядку назви
+     * @param count Кількість предметів
+     * @param ascending true - за зростанням, false - за спаданням
+     * @return Представлення не більше ніж count предметів
+     */
+    SubjectView ViewTopSubjectsByName(size_t count, bool ascending = true) const;
+
+    /**
+     * @brief Повертає перші count предметів за кількістю кредитів ECTS
+     * @details Використовує часткове сортування: O(n log count). Предмети
+     * з однаковою кількістю кредитів упорядковуються за назвою.
+     * @param count Кількість предметів
+     * @param ascending true - від найменшої кількості, false - від найбільшої
+     * @return Представлення не більше ніж count предметів
+     */
+    SubjectView ViewTopSubjectsByCredits(size_t count, bool ascending = false) const;
+
+    // === СКЛАДЕНІ ЗАПИТИ ===
+
+    /**
+     * @brief Виконує складений запит до студентів
+     * @details Кандидати беруться з найвибірковішого індексу серед умов
+     * (програма, ім'я, ID), решта умов перевіряється для кожного кандидата.
+     * @param query Умови, порядок і ліміт
+     * @return Представлення знайдених студентів
+     */
+    StudentView RunQuery(const StudentQuery& query) const;
+
+    /**
+     * @brief Виконує складений запит до викладачів
+     * @details Індексовані умови: кафедра, ім'я, ID.
+     * @param query Умови, порядок і ліміт
+     * @return Представлення знайдених викладачів
+     */
+    TeacherView RunQuery(const TeacherQuery& query) const;
+
+    /**
+     * @brief Виконує складений запит до предметів
+     * @details Індексовані умови: семестр, назва, ID.
+     * @param query Умови, порядок і ліміт
+     * @return Представлення знайдених предметів
+     * @throw std::invalid_argument Якщо значення числового поля не є цілим числом
+     */
+    SubjectView RunQuery(const SubjectQuery& query) const;
+
     // === СОРТУВАННЯ ===
 
     /**
@@ -241,6 +552,29 @@ public:
      */
     void SortSubjectsByName(bool ascending = true);
 
+    /**
+     * @brief Обходить студентів у порядку імені без сортування та копіювання
+     * @details Порядок підтримується індексом при кожній зміні, тож порядок
+     * самої колекції не змінюється.
+     * @param ascending true - за зростанням, false - за спаданням
+     * @param visit Функція, що викликається для кожного студента
+     */
+    void ForEachStudentByName(bool ascending, const std::function<void(const Student&)>& visit) const;
+
+    /**
+     * @brief Обходить викладачів у порядку імені без сортування та копіювання
+     * @param ascending true - за зростанням, false - за спаданням
+     * @param visit Функція, що викликається для кожного викладача
+     */
+    void ForEachTeacherByName(bool ascending, const std::function<void(const Teacher&)>& visit) const;
+
+    /**
+     * @brief Обходить предмети в порядку назви без сортування та копіювання
+     * @param ascending true - за зростанням, false - за спаданням
+     * @param visit Функція, що викликається для кожного предмета
+     */
+    void ForEachSubjectByName(bool ascending, const std::function<void(const Subject&)>& visit) const;
+
     // === ВІДОБРАЖЕННЯ ===
 
     /**
@@ -288,17 +622,39 @@ public:
 
     /**
      * @brief Завантажує дані з файлів
+     * @details Для кожної колекції спершу використовується бінарний знімок,
+     * якщо він відповідає поточному CSV-файлу; інакше читається CSV
+     * і знімок створюється заново. Колекції завантажуються одночасно,
+     * журнал відтворюється після завершення всіх трьох
      * @param studentsFile Файл студентів
      * @param teachersFile Файл викладачів
      * @param subjectsFile Файл предметів
+     * @param results Якщо задано, сюди додається тривалість завантаження кожної колекції
      * @return true якщо успішно, false в іншому випадку
      */
     bool LoadFromFile(const std::string& studentsFile,
                      const std::string& teachersFile,
-                     const std::string& subjectsFile);
+                     const std::string& subjectsFile,
+                     std::vector<SourceLoadResult>* results = nullptr);
+
+    /**
+     * @brief Завантажує дані з файлів, вказаних у конструкторі
+     * @details Єдина точка першого завантаження: якщо дані вже завантажено,
+     * файли повторно не читаються
+     * @param results Якщо задано, сюди додається тривалість завантаження кожної колекції
+     * @return true якщо дані завантажено (зараз або раніше), false в іншому випадку
+     */
+    bool Open(std::vector<SourceLoadResult>* results = nullptr);
+
+    /**
+     * @brief Повертає стан завантаження даних
+     * @return Стан завантаження
+     */
+    LoadState GetLoadState() const;
 
     /**
-     * @brief Зберігає дані у файли
+     * @brief Зберігає всі дані у файли
+     * @details Кожен файл замінюється атомарно через тимчасовий файл
      * @param studentsFile Файл студентів
      * @param teachersFile Файл викладачів
      * @param subjectsFile Файл предметів
@@ -308,6 +664,57 @@ public:
                    const std::string& teachersFile,
                    const std::string& subjectsFile) const;
 
+    /**
+     * @brief Створює контрольну точку
+     * @details Атомарно переписує CSV-файли змінених колекцій та очищає журнал змін
+     * @return true якщо успішно, false в іншому випадку
+     */
+    bool Checkpoint();
+
+    /**
+     * @brief Встановлює кількість записів журналу, після якої створюється контрольна точка
+     * @param interval Кількість записів (0 - лише явні контрольні точки)
+     */
+    void SetCheckpointInterval(size_t interval);
+
+    /**
+     * @brief Встановлює режим збереження змін
+     * @param mode Режим збереження
+     * @param flushWindow Максимальна затримка збереження у фоновому режимі
+     * @param flushBatchSize Кількість змін, після якої фонове збереження виконується негайно
+     */
+    void SetPersistenceMode(PersistenceMode mode,
+                            std::chrono::milliseconds flushWindow = DEFAULT_FLUSH_WINDOW,
+                            size_t flushBatchSize = DEFAULT_FLUSH_BATCH_SIZE);
+
+    /**
+     * @brief Встановлює пул потоків для паралельного перегляду колекцій
+     * @details Пул належить програмі та має існувати, доки менеджер ним користується.
+     * Перевірка умов складених запитів, яких не покриває жоден індекс, для великих
+     * колекцій розподіляється між потоками пулу; невеликі переглядаються послідовно.
+     * @param threadPool Пул потоків (nullptr - лише послідовний перегляд)
+     */
+    void SetThreadPool(ThreadPool* threadPool);
+
+    /**
+     * @brief Повертає поточний режим збереження
+     * @return Режим збереження
+     */
+    PersistenceMode GetPersistenceMode() const;
+
+    /**
+     * @brief Негайно зберігає всі накопичені зміни та чекає завершення
+     * @return true якщо всі зміни збережено, false в іншому випадку
+     */
+    bool Flush();
+
+    /**
+     * @brief Чекає, доки всі зроблені до цього моменту зміни стануть надійними
+     * @details На відміну від Flush() не прискорює збереження, а дочікується вікна
+     * @return true якщо всі зміни збережено, false в іншому випадку
+     */
+    bool WaitDurable();
+
     // === УТІЛІТИ ===
 
     /**
@@ -316,6 +723,69 @@ public:
     void Clear();
 
 private:
+    // === ІНДЕКСИ ЗА ID ===
+
+    /**
+     * @brief Перебудовує дескриптори та похідні індекси всіх колекцій після завантаження
+     * @details Індекси ID заповнюють завантажувачі колекцій разом із самими колекціями.
+     */
+    void RebuildIndexes();
+
+    /**
+     * @brief Знаходить позицію запису за ID за O(1)
+     * @param id ID запису
+     * @return Позиція в колекції або npos, якщо запис не знайдено
+     */
+    size_t FindStudentPosition(const std::string& id) const;
+    size_t FindTeacherPosition(const std::string& id) const;
+    size_t FindSubjectPosition(const std::string& id) const;
+
+    /**
+     * @brief Редагує запис за позицією (спільна частина редагування за ID та за дескриптором)
+     * @param position Позиція запису або NOT_FOUND
+     * @param newData Оновлені дані
+     * @return true якщо успішно, false якщо запис не знайдено
+     * @throw invalid_argument якщо дані некоректні або новий ID уже зайнятий
+     */
+    bool EditStudentAt(size_t position, const Student& newData);
+    bool EditTeacherAt(size_t position, const Teacher& newData);
+    bool EditSubjectAt(size_t position, const Subject& newData);
+
+    /**
+     * @brief Похідні індекси колекції, що оновлюються разом з нею
+     */
+    using StudentIndexSet = std::tuple<ValueIndex<Symbol, Student>&, TrigramIndex<Student>&, OrderedIndex<Student>&>;
+    using TeacherIndexSet = std::tuple<ValueIndex<Symbol, Teacher>&, TrigramIndex<Teacher>&, OrderedIndex<Teacher>&>;
+    using SubjectIndexSet = std::tuple<ValueIndex<int, Subject>&, TrigramIndex<Subject>&, OrderedIndex<Subject>&>;
+    StudentIndexSet StudentIndexes();
+    TeacherIndexSet TeacherIndexes();
+    SubjectIndexSet SubjectIndexes();
+
+    /**
+     * @brief Ключі вторинних і триграмних індексів (категоріальні поля - символами, текст - у нижньому регістрі)
+     */
+    static Symbol ProgramKey(const Student& student);
+    static Symbol DepartmentKey(const Teacher& teacher);
+    static int SemesterKey(const Subject& subject);
+    static std::string StudentNameKey(const Student& student);
+    static std::string TeacherNameKey(const Teacher& teacher);
+    static std::string SubjectNameKey(const Subject& subject);
+
+    /**
+     * @brief Ключі сортування самих колекцій (імена та назви без змін)
+     */
+    static std::string StudentOrderKey(const Student& student);
+    static std::string TeacherOrderKey(const Teacher& teacher);
+    static std::string SubjectOrderKey(const Subject& subject);
+
+    /**
+     * @brief Порівняння впорядкованих індексів за полями рядків таблиці
+     * @details Порядок збігається з порівнянням ключів *OrderKey, але рядки не створюються.
+     */
+    int CompareStudentOrder(StudentHandle left, StudentHandle right) const;
+    int CompareTeacherOrder(TeacherHandle left, TeacherHandle right) const;
+    int CompareSubjectOrder(SubjectHandle left, SubjectHandle right) const;
+
     // === ПРИВАТНІ ФАЙЛОВІ МЕТОДИ ===
 
     bool LoadStudentsFromFile(const std::string& filename);
@@ -324,6 +794,78 @@ private:
     bool SaveStudentsToFile(const std::string& filename) const;
     bool SaveTeachersToFile(const std::string& filename) const;
     bool SaveSubjectsToFile(const std::string& filename) const;
+    std::string SerializeStudents() const;
+    std::string SerializeTeachers() const;
+    std::string SerializeSubjects() const;
+
+    // === БІНАРНІ ЗНІМКИ ===
+
+    bool LoadStudentsFromSnapshot(const std::string& filename);
+    bool LoadTeachersFromSnapshot(const std::string& filename);
+    bool LoadSubjectsFromSnapshot(const std::string& filename);
+    std::string BuildStudentsSnapshot() const;
+    std::string BuildTeachersSnapshot() const;
+    std::string BuildSubjectsSnapshot() const;
+
+    // === ЖУРНАЛ ЗМІН ===
+
+    /**
+     * @brief Записує мутацію в журнал та за потреби створює контрольну точку
+     * @param operation Тип операції
+     * @param collection Колекція
+     * @param id ID запису
+     * @param payload CSV-рядок з новими даними
+     */
+    void LogMutation(JournalOperation operation, JournalCollection collection,
+                     const std::string& id, const std::string& payload);
+
+    /**
+     * @brief Застосовує записи журналу до завантажених даних
+     */
+    void ReplayJournal();
+
+    /**
+     * @brief Застосовує один запис журналу без повторного журналювання
+     * @param record Запис журналу
+     */
+    void ApplyJournalRecord(const JournalRecord& record);
+
+    /**
+     * @brief Зберігає накопичені записи одним груповим записом (викликається фоновим потоком)
+     * @return true якщо успішно, false в іншому випадку
+     */
+    bool FlushPendingRecords();
+
+    /**
+     * @brief Створює контрольну точку (виклик під m_persistenceMutex)
+     * @details Переписує лише колекції, змінені після попередньої контрольної точки
+     * @return true якщо успішно, false в іншому випадку
+     */
+    bool CheckpointLocked();
+
+    /**
+     * @brief Зупиняє фоновий потік, попередньо зберігши накопичені зміни
+     */
+    void StopFlusher();
+
+    /**
+     * @brief Повертає біт колекції в масці змінених колекцій
+     * @param collection Колекція
+     * @return Біт колекції
+     */
+    static unsigned CollectionBit(JournalCollection collection);
+
+    // === ФОРМАТ CSV-ЗАПИСІВ ===
+
+    static std::string FormatStudentRecord(const Student& student);
+    static std::string FormatTeacherRecord(const Teacher& teacher);
+    static std::string FormatSubjectRecord(const Subject& subject);
+    static bool ParseStudentRecord(std::string_view line, Student& student);
+    static bool ParseTeacherRecord(std::string_view line, Teacher& teacher);
+    static bool ParseSubjectRecord(std::string_view line, Subject& subject);
+    static bool ParseStudentFields(const std::vector<std::string_view>& fields, Student& student);
+    static bool ParseTeacherFields(const std::vector<std::string_view>& fields, Teacher& teacher);
+    static bool ParseSubjectFields(const std::vector<std::string_view>& fields, Subject& subject);
 };
 
 } // namespace University
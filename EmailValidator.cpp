@@ -0,0 +1,131 @@
+#include "EmailValidator.h"
+
+#include <array>
+#include <cstdint>
+
+using namespace std;
+
+namespace University {
+
+namespace {
+
+/**
+ * @enum CharClass
+ * @brief Класи символів, що розрізняє автомат
+ */
+enum CharClass : uint8_t {
+    OTHER,     ///< Недопустимий символ
+    LETTER,    ///< a-z, A-Z
+    DIGIT,     ///< 0-9
+    DOT,       ///< .
+    DASH,      ///< -
+    SYMBOL,    ///< _ % + (лише до @)
+    AT,        ///< @
+    CLASS_COUNT
+};
+
+/**
+ * @enum State
+ * @brief Стани автомата
+ *
+ * Домен виду X.Y, де X - [a-zA-Z0-9.-]+, а Y - щонайменше дві літери:
+ * розділювальною може бути лише остання крапка, тож досить пам'ятати,
+ * скільки літер пройдено після неї.
+ */
+enum State : uint8_t {
+    REJECT,        ///< Адреса некоректна
+    LOCAL_START,   ///< Початок локальної частини
+    LOCAL,         ///< Локальна частина
+    DOMAIN_START,  ///< Одразу після @
+    DOMAIN,        ///< Домен без придатного закінчення
+    DOMAIN_DOT,    ///< Крапка після непорожньої частини домену
+    TLD_ONE,       ///< Одна літера після крапки
+    TLD,           ///< Дві й більше літери після крапки (допустимий кінець)
+    STATE_COUNT
+};
+
+constexpr array<uint8_t, 256> BuildClasses()
+{
+    array<uint8_t, 256> classes{};
+    for (int c = 'a'; c <= 'z'; c++)
+    {
+        classes[c] = LETTER;
+        classes[c - 'a' + 'A'] = LETTER;
+    }
+    for (int c = '0'; c <= '9'; c++)
+    {
+        classes[c] = DIGIT;
+    }
+    classes['.'] = DOT;
+    classes['-'] = DASH;
+    classes['_'] = SYMBOL;
+    classes['%'] = SYMBOL;
+    classes['+'] = SYMBOL;
+    classes['@'] = AT;
+    return classes;
+}
+
+constexpr array<array<uint8_t, CLASS_COUNT>, STATE_COUNT> BuildTransitions()
+{
+    array<array<uint8_t, CLASS_COUNT>, STATE_COUNT> next{};
+    // Локальна частина: літери, цифри та . _ % + -
+    for (State state : {LOCAL_START, LOCAL})
+    {
+        for (CharClass type : {LETTER, DIGIT, DOT, DASH, SYMBOL})
+        {
+            next[state][type] = LOCAL;
+        }
+    }
+    next[LOCAL][AT] = DOMAIN_START;
+
+    // Перша крапка домену не може бути розділювальною: перед нею нічого немає
+    for (CharClass type : {LETTER, DIGIT, DOT, DASH})
+    {
+        next[DOMAIN_START][type] = DOMAIN;
+    }
+    for (State state : {DOMAIN, DOMAIN_DOT, TLD_ONE, TLD})
+    {
+        next[state][DIGIT] = DOMAIN;
+        next[state][DASH] = DOMAIN;
+        next[state][DOT] = DOMAIN_DOT;
+    }
+    next[DOMAIN][LETTER] = DOMAIN;
+    next[DOMAIN_DOT][LETTER] = TLD_ONE;
+    next[TLD_ONE][LETTER] = TLD;
+    next[TLD][LETTER] = TLD;
+    return next;
+}
+
+constexpr array<uint8_t, 256> CLASSES = BuildClasses();
+constexpr array<array<uint8_t, CLASS_COUNT>, STATE_COUNT> TRANSITIONS = BuildTransitions();
+
+} // namespace
+
+bool EmailValidator::IsValid(string_view email)
+{
+    uint8_t state = LOCAL_START;
+    for (char c : email)
+    {
+        state = TRANSITIONS[state][CLASSES[static_cast<unsigned char>(c)]];
+        if (state == REJECT)
+        {
+            return false;
+        }
+    }
+    return state == TLD;
+}
+
+vector<size_t> EmailValidator::FindInvalid(const vector<string_view>& emails)
+{
+    vector<size_t> invalid;
+    for (size_t i = 0; i < emails.size(); i++)
+    {
+        if (!IsValid(emails[i]))
+        {
+            invalid.push_back(i);
+        }
+    }
+    return invalid;
+}
+
+} // namespace University
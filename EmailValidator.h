@@ -0,0 +1,43 @@
+/**
+ * @file EmailValidator.h
+ * @brief Заголовний файл для перевірки адрес електронної пошти
+ */
+
+#ifndef EMAILVALIDATOR_H
+#define EMAILVALIDATOR_H
+
+#include <string_view>
+#include <vector>
+
+namespace University {
+
+/**
+ * @class EmailValidator
+ * @brief Перевіряє адреси електронної пошти скінченним автоматом
+ *
+ * Приймає ту саму граматику, що й вираз
+ * [a-zA-Z0-9._%+-]+@[a-zA-Z0-9.-]+\.[a-zA-Z]{2,}, але таблиця переходів
+ * будується під час компіляції, тож перевірка - один прохід по байтах без
+ * створення об'єктів. Граматика допускає лише ASCII: перший же байт
+ * поза ASCII відхиляє адресу.
+ */
+class EmailValidator {
+public:
+    /**
+     * @brief Перевіряє адресу електронної пошти
+     * @param email Адреса
+     * @return true якщо адреса відповідає граматиці
+     */
+    static bool IsValid(std::string_view email);
+
+    /**
+     * @brief Перевіряє багато адрес за один виклик (для імпорту даних)
+     * @param emails Адреси
+     * @return Номери некоректних адрес у порядку зростання
+     */
+    static std::vector<size_t> FindInvalid(const std::vector<std::string_view>& emails);
+};
+
+} // namespace University
+
+#endif // EMAILVALIDATOR_H
@@ -0,0 +1,96 @@
+#include "EntityRows.h"
+
+#include <cstring>
+
+using namespace std;
+
+namespace University {
+
+CompactId CompactId::Make(string_view id, StringPool& strings)
+{
+    CompactId compact{};
+    if (id.size() <= INLINE_CAPACITY)
+    {
+        memcpy(compact.bytes, id.data(), id.size());
+        compact.bytes[INLINE_CAPACITY] = static_cast<char>(id.size());
+    }
+    else
+    {
+        uint32_t text = strings.Add(id);
+        memcpy(compact.bytes, &text, sizeof(text));
+        compact.bytes[INLINE_CAPACITY] = static_cast<char>(POOLED);
+    }
+    return compact;
+}
+
+string_view CompactId::Get(const StringPool& strings) const
+{
+    uint8_t length = static_cast<uint8_t>(bytes[INLINE_CAPACITY]);
+    if (length == POOLED)
+    {
+        uint32_t text;
+        memcpy(&text, bytes, sizeof(text));
+        return strings.Get(text);
+    }
+    return string_view(bytes, length);
+}
+
+// Імена повторюються між записами, тож зберігаються один раз (Intern);
+// email і назви предметів здебільшого унікальні (Add). Для текстових полів,
+// за якими шукають без урахування регістру, пул зберігає й варіант у нижньому
+// регістрі, тож запити не згортають поля кожного запису
+
+RowLayout<Student>::Row RowLayout<Student>::Encode(const Student& student, StringPool& strings)
+{
+    Row row;
+    row.id = CompactId::Make(student.getStudentID(), strings);
+    row.name = strings.InternFolded(student.getName());
+    row.lastName = strings.InternFolded(student.getLastName());
+    row.email = strings.AddFolded(student.getEmail());
+    row.program = student.getEducationalProgramSymbol();
+    return row;
+}
+
+Student RowLayout<Student>::Decode(const Row& row, const StringPool& strings)
+{
+    return Student(TrustedData{}, string(strings.Get(row.name)), string(strings.Get(row.lastName)),
+                   string(strings.Get(row.email)), string(row.id.Get(strings)), row.program.GetText());
+}
+
+RowLayout<Teacher>::Row RowLayout<Teacher>::Encode(const Teacher& teacher, StringPool& strings)
+{
+    Row row;
+    row.id = CompactId::Make(teacher.getTeacherID(), strings);
+    row.name = strings.InternFolded(teacher.getName());
+    row.lastName = strings.InternFolded(teacher.getLastName());
+    row.email = strings.AddFolded(teacher.getEmail());
+    row.department = teacher.getDepartmentSymbol();
+    row.degree = teacher.getAcademicDegree();
+    return row;
+}
+
+Teacher RowLayout<Teacher>::Decode(const Row& row, const StringPool& strings)
+{
+    return Teacher(TrustedData{}, string(strings.Get(row.name)), string(strings.Get(row.lastName)),
+                   string(strings.Get(row.email)), string(row.id.Get(strings)),
+                   row.department.GetText(), row.degree);
+}
+
+RowLayout<Subject>::Row RowLayout<Subject>::Encode(const Subject& subject, StringPool& strings)
+{
+    Row row;
+    row.id = CompactId::Make(subject.getSubjectId(), strings);
+    row.name = strings.AddFolded(subject.getSubjectName());
+    row.teacherId = subject.getTeacherIdSymbol();
+    row.credits = subject.getEctsCredits();
+    row.semester = subject.getSemester();
+    return row;
+}
+
+Subject RowLayout<Subject>::Decode(const Row& row, const StringPool& strings)
+{
+    return Subject(TrustedData{}, string(row.id.Get(strings)), string(strings.Get(row.name)),
+                   row.credits, row.teacherId.GetText(), row.semester);
+}
+
+} // namespace University
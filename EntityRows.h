@@ -0,0 +1,112 @@
+/**
+ * @file EntityRows.h
+ * @brief Заголовний файл з плоскими форматами студентів, викладачів і предметів
+ */
+
+#ifndef ENTITYROWS_H
+#define ENTITYROWS_H
+
+#include "RecordTable.h"
+#include "Student.h"
+#include "Teacher.h"
+#include "Subject.h"
+#include "SymbolTable.h"
+#include <cstdint>
+#include <string>
+#include <string_view>
+
+namespace University {
+
+/**
+ * @struct CompactId
+ * @brief ID запису без окремого виділення пам'яті
+ * @details ID до INLINE_CAPACITY байтів зберігається в самій структурі,
+ * довший - у пулі рядків таблиці. Останній байт - довжина короткого ID
+ * або POOLED, тоді перші 4 байти містять номер ID у пулі.
+ */
+struct CompactId {
+    static constexpr size_t INLINE_CAPACITY = 15;  ///< Найдовший ID, що зберігається в самій структурі
+    static constexpr uint8_t POOLED = 0xFF;        ///< Ознака ID, винесеного в пул рядків
+
+    char bytes[INLINE_CAPACITY + 1];
+
+    /**
+     * @brief Створює компактний ID
+     * @param id ID запису
+     * @param strings Пул для довгих ID
+     */
+    static CompactId Make(std::string_view id, StringPool& strings);
+
+    /**
+     * @brief Повертає ID як рядок
+     * @param strings Пул, у якому створено ID
+     */
+    std::string_view Get(const StringPool& strings) const;
+};
+
+/**
+ * @brief Студент: 32 байти замість понад 200 байтів об'єкта Student і кількох виділень пам'яті
+ * @details Предмети студента не зберігаються: записи на предмети веде AssignmentManager
+ */
+template <>
+struct RowLayout<Student> {
+    struct Row {
+        CompactId id;      ///< ID студента
+        uint32_t name;     ///< Ім'я (номер у пулі)
+        uint32_t lastName; ///< Прізвище (номер у пулі)
+        uint32_t email;    ///< Email (номер у пулі)
+        Symbol program;    ///< Освітня програма
+    };
+
+    static Row Encode(const Student& student, StringPool& strings);
+    static Student Decode(const Row& row, const StringPool& strings);
+    static std::string_view GetId(const Row& row, const StringPool& strings) { return row.id.Get(strings); }
+    static const std::string& IdOf(const Student& student) { return student.getStudentID(); }
+};
+
+/**
+ * @brief Викладач: 36 байтів
+ */
+template <>
+struct RowLayout<Teacher> {
+    struct Row {
+        CompactId id;          ///< ID викладача
+        uint32_t name;         ///< Ім'я (номер у пулі)
+        uint32_t lastName;     ///< Прізвище (номер у пулі)
+        uint32_t email;        ///< Email (номер у пулі)
+        Symbol department;     ///< Кафедра
+        AcademicDegree degree; ///< Академічний ступінь
+    };
+
+    static Row Encode(const Teacher& teacher, StringPool& strings);
+    static Teacher Decode(const Row& row, const StringPool& strings);
+    static std::string_view GetId(const Row& row, const StringPool& strings) { return row.id.Get(strings); }
+    static const std::string& IdOf(const Teacher& teacher) { return teacher.getTeacherID(); }
+};
+
+/**
+ * @brief Предмет: 32 байти
+ */
+template <>
+struct RowLayout<Subject> {
+    struct Row {
+        CompactId id;        ///< ID предмета
+        uint32_t name;       ///< Назва (номер у пулі)
+        Symbol teacherId;    ///< ID викладача
+        int32_t credits;     ///< Кількість кредитів ECTS
+        int32_t semester;    ///< Семестр
+    };
+
+    static Row Encode(const Subject& subject, StringPool& strings);
+    static Subject Decode(const Row& row, const StringPool& strings);
+    static std::string_view GetId(const Row& row, const StringPool& strings) { return row.id.Get(strings); }
+    static const std::string& IdOf(const Subject& subject) { return subject.getSubjectId(); }
+};
+
+static_assert(sizeof(RowLayout<Student>::Row) == 32, "Рядок студента має залишатися компактним");
+static_assert(sizeof(RowLayout<Teacher>::Row) == 36, "Рядок викладача має залишатися компактним");
+static_assert(sizeof(RowLayout<Subject>::Row) == 32, "Рядок предмета має залишатися компактним");
+
+} // namespace University
+
+#endif // ENTITYROWS_H
@@ -7,6 +7,7 @@ namespace University {
     const std::string FileConstants::TEACHERS_FILE = "teachers.csv";
     const std::string FileConstants::SUBJECTS_FILE = "subjects.csv";
     const std::string FileConstants::USERS_FILE = "users.csv";
+    const std::string FileConstants::JOURNAL_FILE = "journal.log";
 
     // User roles
     const std::string FileConstants::ROLE_ADMIN = "Адміністратор";
@@ -21,6 +21,7 @@ namespace University {
         static const std::string TEACHERS_FILE;   ///< Шлях до файлу викладачів
         static const std::string SUBJECTS_FILE;   ///< Шлях до файлу предметів
         static const std::string USERS_FILE;      ///< Шлях до файлу користувачів
+        static const std::string JOURNAL_FILE;    ///< Шлях до журналу змін бази даних
 
         // Ролі користувачів
         static const std::string ROLE_ADMIN;      ///< Роль адміністратора
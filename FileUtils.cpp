@@ -0,0 +1,197 @@
+#include "FileUtils.h"
+
+#include <cstdio>
+#include <iostream>
+
+#ifdef _WIN32
+    #include <windows.h>
+#else
+    #include <fcntl.h>
+    #include <unistd.h>
+    #include <cerrno>
+#endif
+
+using namespace std;
+
+namespace University {
+
+string FileUtils::GetTempFilename(const string& filename)
+{
+    return filename + ".tmp";
+}
+
+#ifdef _WIN32
+
+bool FileUtils::WriteAtomically(const string& filename, const string& content)
+{
+    string tempFilename = GetTempFilename(filename);
+    HANDLE file = CreateFileA(tempFilename.c_str(), GENERIC_WRITE, 0, nullptr, CREATE_ALWAYS,
+                              FILE_ATTRIBUTE_NORMAL, nullptr);
+    if (file == INVALID_HANDLE_VALUE)
+    {
+        cerr << "Не вдалося відкрити тимчасовий файл: " << tempFilename << endl;
+        return false;
+    }
+
+    const char* data = content.data();
+    size_t remaining = content.size();
+    while (remaining > 0)
+    {
+        DWORD chunk = remaining > 0x40000000 ? 0x40000000 : static_cast<DWORD>(remaining);
+        DWORD written = 0;
+        if (!WriteFile(file, data, chunk, &written, nullptr) || written == 0)
+        {
+            cerr << "Помилка запису тимчасового файлу: " << tempFilename << endl;
+            CloseHandle(file);
+            DeleteFileA(tempFilename.c_str());
+            return false;
+        }
+        data += written;
+        remaining -= written;
+    }
+
+    // MOVEFILE_WRITE_THROUGH робить надійним лише перейменування, тож дані скидаємо окремо
+    bool synced = FlushFileBuffers(file) != 0;
+    bool closed = CloseHandle(file) != 0;
+    if (!synced || !closed)
+    {
+        cerr << "Не вдалося скинути на диск файл: " << tempFilename << endl;
+        DeleteFileA(tempFilename.c_str());
+        return false;
+    }
+
+    // MOVEFILE_WRITE_THROUGH повертає керування лише після скидання перейменування на диск
+    if (!MoveFileExA(tempFilename.c_str(), filename.c_str(),
+                     MOVEFILE_REPLACE_EXISTING | MOVEFILE_WRITE_THROUGH))
+    {
+        cerr << "Не вдалося замінити файл: " << filename << endl;
+        DeleteFileA(tempFilename.c_str());
+        return false;
+    }
+    return true;
+}
+
+bool FileUtils::SyncFile(const string& filename, bool)
+{
+    HANDLE file = CreateFileA(filename.c_str(), GENERIC_WRITE, FILE_SHARE_READ | FILE_SHARE_WRITE,
+                              nullptr, OPEN_EXISTING, FILE_ATTRIBUTE_NORMAL, nullptr);
+    if (file == INVALID_HANDLE_VALUE)
+    {
+        cerr << "Не вдалося відкрити файл: " << filename << endl;
+        return false;
+    }
+    bool synced = FlushFileBuffers(file) != 0;
+    CloseHandle(file);
+    if (!synced)
+    {
+        cerr << "Не вдалося скинути на диск файл: " << filename << endl;
+    }
+    return synced;
+}
+
+#else
+
+namespace {
+
+string GetDirectory(const string& filename)
+{
+    size_t slash = filename.find_last_of('/');
+    if (slash == string::npos)
+    {
+        return ".";
+    }
+    return slash == 0 ? "/" : filename.substr(0, slash);
+}
+
+void SyncDirectory(const string& filename)
+{
+    int dirFd = open(GetDirectory(filename).c_str(), O_RDONLY);
+    if (dirFd >= 0)
+    {
+        fsync(dirFd);
+        close(dirFd);
+    }
+}
+
+} // namespace
+
+bool FileUtils::WriteAtomically(const string& filename, const string& content)
+{
+    string tempFilename = GetTempFilename(filename);
+    int fd = open(tempFilename.c_str(), O_WRONLY | O_CREAT | O_TRUNC, 0644);
+    if (fd < 0)
+    {
+        cerr << "Не вдалося відкрити тимчасовий файл: " << tempFilename << endl;
+        return false;
+    }
+
+    const char* data = content.data();
+    size_t remaining = content.size();
+    while (remaining > 0)
+    {
+        ssize_t written = write(fd, data, remaining);
+        if (written < 0)
+        {
+            if (errno == EINTR)
+            {
+                continue;
+            }
+            cerr << "Помилка запису тимчасового файлу: " << tempFilename << endl;
+            close(fd);
+            unlink(tempFilename.c_str());
+            return false;
+        }
+        data += written;
+        remaining -= static_cast<size_t>(written);
+    }
+
+    // close викликаємо завжди, інакше невдалий fsync залишав би дескриптор відкритим
+    bool synced = fsync(fd) == 0;
+    bool closed = close(fd) == 0;
+    if (!synced || !closed)
+    {
+        cerr << "Не вдалося скинути на диск файл: " << tempFilename << endl;
+        unlink(tempFilename.c_str());
+        return false;
+    }
+
+    if (rename(tempFilename.c_str(), filename.c_str()) != 0)
+    {
+        cerr << "Не вдалося замінити файл: " << filename << endl;
+        unlink(tempFilename.c_str());
+        return false;
+    }
+
+    // Скидаємо каталог, щоб саме перейменування пережило збій живлення
+    SyncDirectory(filename);
+    return true;
+}
+
+bool FileUtils::SyncFile(const string& filename, bool syncDirectory)
+{
+    // fsync скидає всі змінені дані файлу, а не лише записані через цей дескриптор
+    int fd = open(filename.c_str(), O_WRONLY | O_APPEND);
+    if (fd < 0)
+    {
+        cerr << "Не вдалося відкрити файл: " << filename << endl;
+        return false;
+    }
+
+    bool synced = fsync(fd) == 0;
+    close(fd);
+    if (!synced)
+    {
+        cerr << "Не вдалося скинути на диск файл: " << filename << endl;
+        return false;
+    }
+
+    if (syncDirectory)
+    {
+        SyncDirectory(filename);
+    }
+    return true;
+}
+
+#endif
+
+} // namespace University
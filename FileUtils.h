@@ -0,0 +1,50 @@
+/**
+ * @file FileUtils.h
+ * @brief Заголовний файл з допоміжними функціями для надійного запису файлів
+ */
+
+#ifndef FILEUTILS_H
+#define FILEUTILS_H
+
+#include <string>
+
+namespace University {
+
+/**
+ * @class FileUtils
+ * @brief Допоміжні файлові операції
+ */
+class FileUtils {
+public:
+    /**
+     * @brief Атомарно замінює вміст файлу
+     * @details Дані записуються у тимчасовий файл поруч, скидаються на диск (fsync)
+     * і лише потім перейменовуються на місце цільового файлу, тож після збою
+     * на диску залишається або старий, або новий вміст, але не половина файлу.
+     * @param filename Шлях до цільового файлу
+     * @param content Новий вміст файлу
+     * @return true якщо успішно, false в іншому випадку
+     */
+    static bool WriteAtomically(const std::string& filename, const std::string& content);
+
+    /**
+     * @brief Скидає на диск (fsync) дані, вже записані у файл
+     * @details Використовується для файлів, що дописуються в кінець: після
+     * успішного виклику записані дані переживуть збій живлення.
+     * @param filename Шлях до файлу
+     * @param syncDirectory Також скинути каталог (потрібно для щойно створеного файлу)
+     * @return true якщо успішно, false в іншому випадку
+     */
+    static bool SyncFile(const std::string& filename, bool syncDirectory = false);
+
+    /**
+     * @brief Повертає шлях до тимчасового файлу для атомарного запису
+     * @param filename Шлях до цільового файлу
+     * @return Шлях до тимчасового файлу
+     */
+    static std::string GetTempFilename(const std::string& filename);
+};
+
+} // namespace University
+
+#endif // FILEUTILS_H
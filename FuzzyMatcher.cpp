@@ -0,0 +1,151 @@
+#include "FuzzyMatcher.h"
+#include "TextUtils.h"
+
+#include <algorithm>
+
+using namespace std;
+
+namespace University {
+
+FuzzyMatcher::FuzzyMatcher(string_view pattern)
+    : m_directMasks(DIRECT_TABLE_SIZE, 0), m_maxCharBytes(1)
+{
+    for (size_t position = 0; position < pattern.size();)
+    {
+        char32_t codePoint;
+        size_t length = TextUtils::NextCodePoint(pattern, position, codePoint);
+        m_pattern += codePoint;
+        m_maxCharBytes = max(m_maxCharBytes, length);
+        position += length;
+    }
+
+    if (m_pattern.size() > MAX_BIT_PARALLEL_LENGTH)
+    {
+        return;
+    }
+    for (size_t i = 0; i < m_pattern.size(); i++)
+    {
+        uint64_t bit = uint64_t(1) << i;
+        char32_t codePoint = m_pattern[i];
+        if (codePoint < DIRECT_TABLE_SIZE)
+        {
+            m_directMasks[codePoint] |= bit;
+            continue;
+        }
+        auto it = find_if(m_otherMasks.begin(), m_otherMasks.end(),
+            [codePoint](const auto& entry) { return entry.first == codePoint; });
+        if (it != m_otherMasks.end())
+        {
+            it->second |= bit;
+        }
+        else
+        {
+            m_otherMasks.emplace_back(codePoint, bit);
+        }
+    }
+}
+
+size_t FuzzyMatcher::GetLength() const
+{
+    return m_pattern.size();
+}
+
+size_t FuzzyMatcher::GetMaxCharBytes() const
+{
+    return m_maxCharBytes;
+}
+
+size_t FuzzyMatcher::Distance(string_view text) const
+{
+    if (m_pattern.empty())
+    {
+        return 0;
+    }
+    return m_pattern.size() <= MAX_BIT_PARALLEL_LENGTH ? BitParallelDistance(text) : TableDistance(text);
+}
+
+uint64_t FuzzyMatcher::MaskOf(char32_t codePoint) const
+{
+    if (codePoint < DIRECT_TABLE_SIZE)
+    {
+        return m_directMasks[codePoint];
+    }
+    for (const auto& entry : m_otherMasks)
+    {
+        if (entry.first == codePoint)
+        {
+            return entry.second;
+        }
+    }
+    return 0;
+}
+
+size_t FuzzyMatcher::BitParallelDistance(string_view text) const
+{
+    // Біт i векторів Pv/Mv - зміна (+1/-1) значення в рядку i стовпчика таблиці
+    const size_t length = m_pattern.size();
+    const uint64_t lastBit = uint64_t(1) << (length - 1);
+    uint64_t positiveVertical = ~uint64_t(0);
+    uint64_t negativeVertical = 0;
+    size_t score = length;
+    size_t best = length;
+
+    for (size_t position = 0; position < text.size();)
+    {
+        char32_t codePoint;
+        position += TextUtils::NextCodePoint(text, position, codePoint);
+
+        uint64_t equal = MaskOf(codePoint);
+        uint64_t verticalChange = equal | negativeVertical;
+        uint64_t horizontalChange = (((equal & positiveVertical) + positiveVertical) ^ positiveVertical) | equal;
+        uint64_t positiveHorizontal = negativeVertical | ~(horizontalChange | positiveVertical);
+        uint64_t negativeHorizontal = positiveVertical & horizontalChange;
+
+        if (positiveHorizontal & lastBit)
+        {
+            score++;
+        }
+        else if (negativeHorizontal & lastBit)
+        {
+            score--;
+        }
+
+        // Перший рядок таблиці нульовий: збіг може починатися в будь-якому місці тексту
+        positiveHorizontal <<= 1;
+        negativeHorizontal <<= 1;
+        positiveVertical = negativeHorizontal | ~(verticalChange | positiveHorizontal);
+        negativeVertical = positiveHorizontal & verticalChange;
+        best = min(best, score);
+    }
+    return best;
+}
+
+size_t FuzzyMatcher::TableDistance(string_view text) const
+{
+    const size_t length = m_pattern.size();
+    vector<size_t> column(length + 1);
+    for (size_t i = 0; i <= length; i++)
+    {
+        column[i] = i;
+    }
+    size_t best = length;
+
+    for (size_t position = 0; position < text.size();)
+    {
+        char32_t codePoint;
+        position += TextUtils::NextCodePoint(text, position, codePoint);
+
+        size_t diagonal = column[0];
+        for (size_t i = 1; i <= length; i++)
+        {
+            size_t above = column[i];
+            column[i] = min({above + 1, column[i - 1] + 1,
+                             diagonal + (m_pattern[i - 1] == codePoint ? 0 : 1)});
+            diagonal = above;
+        }
+        best = min(best, column[length]);
+    }
+    return best;
+}
+
+} // namespace University
@@ -0,0 +1,75 @@
+/**
+ * @file FuzzyMatcher.h
+ * @brief Заголовний файл для нечіткого пошуку з обмеженою відстанню редагування
+ */
+
+#ifndef FUZZYMATCHER_H
+#define FUZZYMATCHER_H
+
+#include <cstdint>
+#include <string>
+#include <string_view>
+#include <utility>
+#include <vector>
+
+namespace University {
+
+/**
+ * @class FuzzyMatcher
+ * @brief Знаходить найменшу відстань редагування між запитом і частиною тексту
+ *
+ * Відстань рахується в символах UTF-8, а не в байтах: заміна однієї
+ * кириличної літери коштує 1. Для запитів до 64 символів використовується
+ * біт-паралельний алгоритм Маєрса (у формулюванні Хіре): один стовпчик
+ * таблиці динамічного програмування обчислюється кількома операціями
+ * над 64-бітним словом, тож перевірка назви коштує O(n) замість O(m * n).
+ * Довші запити перевіряються звичайною динамічною таблицею.
+ *
+ * Запит шукається як частина тексту: "шевченка" знаходиться в
+ * "тарас шевченко" з відстанню 1.
+ */
+class FuzzyMatcher {
+private:
+    static const size_t DIRECT_TABLE_SIZE = 0x500;  ///< Коди, що шукаються прямим індексом (латиниця та кирилиця)
+
+    std::u32string m_pattern;                               ///< Символи запиту
+    std::vector<uint64_t> m_directMasks;                    ///< Код символу -> бітова маска його позицій у запиті
+    std::vector<std::pair<char32_t, uint64_t>> m_otherMasks; ///< Маски решти символів запиту
+    size_t m_maxCharBytes;                                  ///< Найбільша довжина символу запиту в байтах
+
+    uint64_t MaskOf(char32_t codePoint) const;
+    size_t BitParallelDistance(std::string_view text) const;
+    size_t TableDistance(std::string_view text) const;
+
+public:
+    static const size_t MAX_BIT_PARALLEL_LENGTH = 64;  ///< Найдовший запит для біт-паралельного алгоритму
+
+    /**
+     * @brief Конструктор з параметрами
+     * @param pattern Запит (у тій самій нормалізації, що й тексти)
+     */
+    explicit FuzzyMatcher(std::string_view pattern);
+
+    /**
+     * @brief Повертає кількість символів запиту
+     */
+    size_t GetLength() const;
+
+    /**
+     * @brief Повертає найбільшу довжину символу запиту в байтах UTF-8
+     * @details Одна правка запиту руйнує не більше ніж (ця довжина + 2)
+     * байтових триграми, що дозволяє відсіювати кандидатів за триграмами.
+     */
+    size_t GetMaxCharBytes() const;
+
+    /**
+     * @brief Обчислює найменшу відстань редагування між запитом і частиною тексту
+     * @param text Текст
+     * @return Кількість вставок, видалень і замін символів
+     */
+    size_t Distance(std::string_view text) const;
+};
+
+} // namespace University
+
+#endif // FUZZYMATCHER_H
@@ -0,0 +1,289 @@
+#include "Journal.h"
+
+#include <filesystem>
+#include <iostream>
+
+#include "Csv.h"
+#include "FileUtils.h"
+
+using namespace std;
+
+namespace University {
+
+namespace {
+
+string OperationToString(JournalOperation operation)
+{
+    switch (operation)
+    {
+        case JournalOperation::Add:
+            return "ADD";
+        case JournalOperation::Edit:
+            return "EDIT";
+        case JournalOperation::Delete:
+            return "DELETE";
+    }
+    return "";
+}
+
+string CollectionToString(JournalCollection collection)
+{
+    switch (collection)
+    {
+        case JournalCollection::Students:
+            return "STUDENT";
+        case JournalCollection::Teachers:
+            return "TEACHER";
+        case JournalCollection::Subjects:
+            return "SUBJECT";
+    }
+    return "";
+}
+
+bool ParseOperation(const string& text, JournalOperation& operation)
+{
+    if (text == "ADD")
+    {
+        operation = JournalOperation::Add;
+    }
+    else if (text == "EDIT")
+    {
+        operation = JournalOperation::Edit;
+    }
+    else if (text == "DELETE")
+    {
+        operation = JournalOperation::Delete;
+    }
+    else
+    {
+        return false;
+    }
+    return true;
+}
+
+bool ParseCollection(const string& text, JournalCollection& collection)
+{
+    if (text == "STUDENT")
+    {
+        collection = JournalCollection::Students;
+    }
+    else if (text == "TEACHER")
+    {
+        collection = JournalCollection::Teachers;
+    }
+    else if (text == "SUBJECT")
+    {
+        collection = JournalCollection::Subjects;
+    }
+    else
+    {
+        return false;
+    }
+    return true;
+}
+
+/**
+ * @brief Дописує запис у буфер одним рядком, що завершується символом нового рядка
+ */
+void AppendRecord(string& buffer, const JournalRecord& record)
+{
+    buffer += OperationToString(record.operation);
+    buffer += '|';
+    buffer += CollectionToString(record.collection);
+    buffer += '|';
+    CsvWriter::AppendField(buffer, record.id, '|');
+    buffer += '|';
+    CsvWriter::AppendField(buffer, record.payload, '|');
+    buffer += '\n';
+}
+
+} // namespace
+
+Journal::Journal(const string& filename)
+    : m_filename(filename), m_recordCount(0)
+{
+}
+
+Journal::Journal(Journal&& other) noexcept
+    : m_filename(std::move(other.m_filename)), m_stream(std::move(other.m_stream)),
+      m_recordCount(other.m_recordCount)
+{
+    other.m_recordCount = 0;
+}
+
+Journal& Journal::operator=(Journal&& other) noexcept
+{
+    if (this != &other)
+    {
+        m_filename = std::move(other.m_filename);
+        m_stream = std::move(other.m_stream);
+        m_recordCount = other.m_recordCount;
+        other.m_recordCount = 0;
+    }
+    return *this;
+}
+
+bool Journal::Append(const JournalRecord& record)
+{
+    return AppendBatch({record});
+}
+
+bool Journal::AppendBatch(const vector<JournalRecord>& records)
+{
+    if (records.empty())
+    {
+        return true;
+    }
+
+    bool opened = false;
+    if (!m_stream.is_open())
+    {
+        opened = true;
+        m_stream.open(m_filename, ios::app);
+        if (!m_stream.is_open())
+        {
+            cerr << "Не вдалося відкрити журнал змін: " << m_filename << endl;
+            return false;
+        }
+    }
+
+    // Запис завершується лише символом нового рядка: рядок без нього
+    // вважається недописаним і ігнорується під час відтворення
+    string buffer;
+    for (const auto& record : records)
+    {
+        AppendRecord(buffer, record);
+    }
+    m_stream.write(buffer.data(), buffer.size());
+    m_stream.flush();
+
+    if (!m_stream)
+    {
+        cerr << "Помилка запису в журнал змін: " << m_filename << endl;
+        m_stream.close();
+        return false;
+    }
+
+    // flush лише передає дані системі: зміна вважається збереженою після fsync.
+    // Щойно відкритий файл міг бути створений, тож скидається і каталог
+    if (!FileUtils::SyncFile(m_filename, opened))
+    {
+        m_stream.close();
+        return false;
+    }
+
+    m_recordCount += records.size();
+    return true;
+}
+
+vector<JournalRecord> Journal::ReadAll(bool* damaged) const
+{
+    vector<JournalRecord> records;
+    if (damaged)
+    {
+        *damaged = false;
+    }
+    ifstream file(m_filename, ios::binary);
+    if (!file.is_open())
+    {
+        return records;
+    }
+
+    string content((istreambuf_iterator<char>(file)), istreambuf_iterator<char>());
+    CsvReader reader(content, '|');
+    while (reader.Next())
+    {
+        if (!reader.IsTerminated())
+        {
+            if (damaged)
+            {
+                *damaged = true;
+            }
+            continue;
+        }
+
+        JournalRecord record;
+        if (reader.GetFieldCount() == 4 &&
+            ParseOperation(string(reader.GetField(0)), record.operation) &&
+            ParseCollection(string(reader.GetField(1)), record.collection))
+        {
+            record.id = string(reader.GetField(2));
+            record.payload = string(reader.GetField(3));
+            records.push_back(std::move(record));
+        }
+        else
+        {
+            cerr << "Пропущено пошкоджений запис журналу: " << reader.GetField(0) << endl;
+            if (damaged)
+            {
+                *damaged = true;
+            }
+        }
+    }
+
+    return records;
+}
+
+bool Journal::Truncate()
+{
+    if (m_stream.is_open())
+    {
+        m_stream.close();
+    }
+
+    ofstream file(m_filename, ios::trunc);
+    if (!file.is_open())
+    {
+        // Журнал так і не вдалося створити - очищати нічого
+        error_code error;
+        if (!filesystem::exists(m_filename, error) && !error)
+        {
+            m_recordCount = 0;
+            return true;
+        }
+        cerr << "Не вдалося очистити журнал змін: " << m_filename << endl;
+        return false;
+    }
+
+    m_recordCount = 0;
+    return true;
+}
+
+bool Journal::Rewrite(const vector<JournalRecord>& records)
+{
+    if (m_stream.is_open())
+    {
+        m_stream.close();
+    }
+
+    string buffer;
+    for (const auto& record : records)
+    {
+        AppendRecord(buffer, record);
+    }
+    if (!FileUtils::WriteAtomically(m_filename, buffer))
+    {
+        cerr << "Не вдалося перезаписати журнал змін: " << m_filename << endl;
+        return false;
+    }
+
+    m_recordCount = records.size();
+    return true;
+}
+
+void Journal::SetRecordCount(size_t count)
+{
+    m_recordCount = count;
+}
+
+size_t Journal::GetRecordCount() const
+{
+    return m_recordCount;
+}
+
+const string& Journal::GetFilename() const
+{
+    return m_filename;
+}
+
+} // namespace University
@@ -0,0 +1,135 @@
+/**
+ * @file Journal.h
+ * @brief Заголовний файл для журналу змін бази даних (write-ahead log)
+ */
+
+#ifndef JOURNAL_H
+#define JOURNAL_H
+
+#include <fstream>
+#include <string>
+#include <vector>
+
+namespace University {
+
+/**
+ * @enum JournalOperation
+ * @brief Тип операції, записаної в журнал
+ */
+enum class JournalOperation {
+    Add,     ///< Додавання запису
+    Edit,    ///< Редагування запису
+    Delete   ///< Видалення запису
+};
+
+/**
+ * @enum JournalCollection
+ * @brief Колекція, до якої відноситься операція
+ */
+enum class JournalCollection {
+    Students,  ///< Студенти
+    Teachers,  ///< Викладачі
+    Subjects   ///< Предмети
+};
+
+/**
+ * @struct JournalRecord
+ * @brief Один запис журналу змін
+ */
+struct JournalRecord {
+    JournalOperation operation;    ///< Тип операції
+    JournalCollection collection;  ///< Колекція
+    std::string id;                ///< ID запису, до якого застосовано операцію
+    std::string payload;           ///< CSV-рядок з новими даними (порожній для видалення)
+};
+
+/**
+ * @class Journal
+ * @brief Журнал змін, що лише дописується в кінець файлу
+ *
+ * Кожна мутація бази даних записується одним рядком формату
+ * "операція|колекція|ID|дані", тож вартість збереження залежить
+ * від розміру зміни, а не від розміру всієї бази. ID та дані, що містять
+ * роздільник, лапки чи перенос рядка, беруться в лапки за RFC 4180.
+ */
+class Journal {
+private:
+    std::string m_filename;    ///< Шлях до файлу журналу
+    std::ofstream m_stream;    ///< Потік для дописування (відкривається за потреби)
+    size_t m_recordCount;      ///< Кількість записів з моменту останньої контрольної точки
+
+public:
+    /**
+     * @brief Конструктор з параметрами
+     * @param filename Шлях до файлу журналу
+     */
+    explicit Journal(const std::string& filename);
+
+    // Два об'єкти не повинні дописувати в один файл журналу
+    Journal(const Journal&) = delete;
+    Journal& operator=(const Journal&) = delete;
+
+    /**
+     * @brief Конструктор переміщення
+     * @param other Об'єкт для переміщення
+     */
+    Journal(Journal&& other) noexcept;
+
+    /**
+     * @brief Оператор присвоювання переміщенням
+     * @param other Об'єкт для переміщення
+     * @return Посилання на поточний об'єкт
+     */
+    Journal& operator=(Journal&& other) noexcept;
+
+    /**
+     * @brief Дописує запис у кінець журналу
+     * @param record Запис для додавання
+     * @return true якщо успішно, false в іншому випадку
+     */
+    bool Append(const JournalRecord& record);
+
+    /**
+     * @brief Дописує кілька записів одним звертанням до файлу (груповий запис)
+     * @details Повертає керування після скидання даних на диск (fsync)
+     * @param records Записи для додавання
+     * @return true якщо успішно, false в іншому випадку
+     */
+    bool AppendBatch(const std::vector<JournalRecord>& records);
+
+    /**
+     * @brief Зчитує всі коректні записи журналу
+     * @details Пошкоджений (недописаний) останній рядок пропускається
+     * @param damaged Якщо не nullptr, отримує true, коли у файлі були пропущені записи
+     * @return Вектор записів у порядку їх додавання
+     */
+    std::vector<JournalRecord> ReadAll(bool* damaged = nullptr) const;
+
+    /**
+     * @brief Очищає журнал після контрольної точки
+     * @return true якщо успішно, false в іншому випадку
+     */
+    bool Truncate();
+
+    /**
+     * @brief Атомарно замінює журнал переліком записів
+     * @details Використовується після частково невдалої контрольної точки:
+     * у журналі залишаються лише зміни колекцій, які не вдалося зберегти
+     * @param records Записи, що залишаються в журналі
+     * @return true якщо успішно, false в іншому випадку
+     */
+    bool Rewrite(const std::vector<JournalRecord>& records);
+
+    /**
+     * @brief Встановлює кількість записів (після відтворення журналу)
+     * @param count Кількість записів
+     */
+    void SetRecordCount(size_t count);
+
+    size_t GetRecordCount() const;
+    const std::string& GetFilename() const;
+};
+
+} // namespace University
+
+#endif // JOURNAL_H
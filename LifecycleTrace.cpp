@@ -0,0 +1,120 @@
+#include "LifecycleTrace.h"
+
+#include <atomic>
+#include <cstdlib>
+#include <cstring>
+#include <iostream>
+
+using namespace std;
+
+namespace University {
+
+namespace {
+
+const size_t ENTITY_COUNT = static_cast<size_t>(TracedEntity::Count);
+const size_t EVENT_COUNT = static_cast<size_t>(LifecycleEvent::Count);
+
+const char* const ENTITY_NAMES[ENTITY_COUNT] = {"Student", "Teacher", "Subject"};
+const char* const EVENT_NAMES[EVENT_COUNT] = {"construct", "copy", "move", "destroy"};
+
+/**
+ * @brief Читає початковий режим зі змінної середовища UNIVERSITY_TRACE_LIFECYCLE
+ */
+int InitialMode()
+{
+    const char* value = getenv("UNIVERSITY_TRACE_LIFECYCLE");
+    if (!value || !*value || strcmp(value, "0") == 0)
+    {
+        return 0;
+    }
+    return strcmp(value, "verbose") == 0 ? 2 : 1;
+}
+
+// Події можуть надходити з кількох потоків (паралельне завантаження)
+atomic<uint64_t> g_counters[ENTITY_COUNT][EVENT_COUNT];
+atomic<bool> g_enabled{InitialMode() > 0};
+atomic<bool> g_verbose{InitialMode() > 1};
+
+} // namespace
+
+bool LifecycleTrace::IsCompiledIn()
+{
+#ifdef UNIVERSITY_TRACE_LIFECYCLE
+    return true;
+#else
+    return false;
+#endif
+}
+
+void LifecycleTrace::SetEnabled(bool enabled)
+{
+    g_enabled.store(enabled, memory_order_relaxed);
+}
+
+bool LifecycleTrace::IsEnabled()
+{
+    return g_enabled.load(memory_order_relaxed);
+}
+
+void LifecycleTrace::SetVerbose(bool verbose)
+{
+    g_verbose.store(verbose, memory_order_relaxed);
+}
+
+void LifecycleTrace::Record(TracedEntity entity, LifecycleEvent event)
+{
+    if (!g_enabled.load(memory_order_relaxed))
+    {
+        return;
+    }
+    size_t entityIndex = static_cast<size_t>(entity);
+    size_t eventIndex = static_cast<size_t>(event);
+    g_counters[entityIndex][eventIndex].fetch_add(1, memory_order_relaxed);
+    if (g_verbose.load(memory_order_relaxed))
+    {
+        cerr << "[lifecycle] " << ENTITY_NAMES[entityIndex] << " " << EVENT_NAMES[eventIndex] << "\n";
+    }
+}
+
+LifecycleCounters LifecycleTrace::GetCounters(TracedEntity entity)
+{
+    const auto& counters = g_counters[static_cast<size_t>(entity)];
+    LifecycleCounters result;
+    result.constructed = counters[static_cast<size_t>(LifecycleEvent::Construct)].load(memory_order_relaxed);
+    result.copied = counters[static_cast<size_t>(LifecycleEvent::Copy)].load(memory_order_relaxed);
+    result.moved = counters[static_cast<size_t>(LifecycleEvent::Move)].load(memory_order_relaxed);
+    result.destroyed = counters[static_cast<size_t>(LifecycleEvent::Destroy)].load(memory_order_relaxed);
+    return result;
+}
+
+void LifecycleTrace::Reset()
+{
+    for (auto& entityCounters : g_counters)
+    {
+        for (auto& counter : entityCounters)
+        {
+            counter.store(0, memory_order_relaxed);
+        }
+    }
+}
+
+void LifecycleTrace::PrintReport(ostream& out)
+{
+    if (!IsCompiledIn())
+    {
+        out << "Трасування життєвого циклу не скомпільовано (опція UNIVERSITY_TRACE_LIFECYCLE)" << endl;
+        return;
+    }
+    out << "=== ЖИТТЄВИЙ ЦИКЛ ОБ'ЄКТІВ ===" << endl;
+    for (size_t i = 0; i < ENTITY_COUNT; i++)
+    {
+        LifecycleCounters counters = GetCounters(static_cast<TracedEntity>(i));
+        out << ENTITY_NAMES[i]
+            << ": створено " << counters.constructed
+            << ", скопійовано " << counters.copied
+            << ", переміщено " << counters.moved
+            << ", знищено " << counters.destroyed << endl;
+    }
+}
+
+} // namespace University
@@ -0,0 +1,118 @@
+/**
+ * @file LifecycleTrace.h
+ * @brief Заголовний файл для трасування життєвого циклу об'єктів
+ */
+
+#ifndef LIFECYCLETRACE_H
+#define LIFECYCLETRACE_H
+
+#include <cstdint>
+#include <ostream>
+
+namespace University {
+
+/**
+ * @enum TracedEntity
+ * @brief Типи сутностей, життєвий цикл яких відстежується
+ */
+enum class TracedEntity {
+    Student,   ///< Студент
+    Teacher,   ///< Викладач
+    Subject,   ///< Предмет
+    Count      ///< Кількість типів
+};
+
+/**
+ * @enum LifecycleEvent
+ * @brief Подія життєвого циклу об'єкта
+ */
+enum class LifecycleEvent {
+    Construct, ///< Створення (крім копіювання та переміщення)
+    Copy,      ///< Копіювання (конструктор або присвоєння)
+    Move,      ///< Переміщення (конструктор або присвоєння)
+    Destroy,   ///< Знищення
+    Count      ///< Кількість подій
+};
+
+/**
+ * @struct LifecycleCounters
+ * @brief Лічильники подій для одного типу сутності
+ */
+struct LifecycleCounters {
+    uint64_t constructed = 0;  ///< Кількість створень
+    uint64_t copied = 0;       ///< Кількість копіювань
+    uint64_t moved = 0;        ///< Кількість переміщень
+    uint64_t destroyed = 0;    ///< Кількість знищень
+};
+
+/**
+ * @class LifecycleTrace
+ * @brief Лічильники створення, копіювання, переміщення та знищення сутностей
+ *
+ * Призначене для налагодження: показує, скільки копій створюють списки,
+ * пошук і перерозподіл векторів. Виклики TRACE_LIFECYCLE компілюються
+ * лише з опцією збірки UNIVERSITY_TRACE_LIFECYCLE, інакше не генерують
+ * жодного коду. У такій збірці підрахунок вмикається SetEnabled() або
+ * змінною середовища UNIVERSITY_TRACE_LIFECYCLE (1 - лічильники,
+ * verbose - ще й рядок на кожну подію).
+ */
+class LifecycleTrace {
+public:
+    /**
+     * @brief Перевіряє, чи скомпільовано трасування
+     */
+    static bool IsCompiledIn();
+
+    /**
+     * @brief Вмикає або вимикає підрахунок подій
+     * @param enabled true - підраховувати події
+     */
+    static void SetEnabled(bool enabled);
+
+    /**
+     * @brief Перевіряє, чи ввімкнено підрахунок подій
+     */
+    static bool IsEnabled();
+
+    /**
+     * @brief Вмикає або вимикає вивід рядка в std::cerr на кожну подію
+     * @param verbose true - виводити кожну подію
+     */
+    static void SetVerbose(bool verbose);
+
+    /**
+     * @brief Реєструє подію (викликається через TRACE_LIFECYCLE)
+     * @param entity Тип сутності
+     * @param event Подія
+     */
+    static void Record(TracedEntity entity, LifecycleEvent event);
+
+    /**
+     * @brief Повертає лічильники для типу сутності
+     * @param entity Тип сутності
+     */
+    static LifecycleCounters GetCounters(TracedEntity entity);
+
+    /**
+     * @brief Обнуляє всі лічильники
+     */
+    static void Reset();
+
+    /**
+     * @brief Виводить таблицю лічильників
+     * @param out Потік виводу
+     */
+    static void PrintReport(std::ostream& out);
+};
+
+} // namespace University
+
+#ifdef UNIVERSITY_TRACE_LIFECYCLE
+    #define TRACE_LIFECYCLE(entity, event) \
+        ::University::LifecycleTrace::Record(::University::TracedEntity::entity, \
+                                             ::University::LifecycleEvent::event)
+#else
+    #define TRACE_LIFECYCLE(entity, event) ((void)0)
+#endif
+
+#endif // LIFECYCLETRACE_H
@@ -0,0 +1,39 @@
+/**
+ * @file LoadState.h
+ * @brief Заголовний файл зі станом завантаження даних менеджерів
+ */
+
+#ifndef LOADSTATE_H
+#define LOADSTATE_H
+
+#include <chrono>
+#include <string>
+
+namespace University {
+
+/**
+ * @enum LoadState
+ * @brief Стан завантаження даних менеджера з файлів
+ *
+ * Менеджери створюються порожніми (NotLoaded) і завантажуються одним
+ * викликом Open(); повторний Open() нічого не читає.
+ */
+enum class LoadState {
+    NotLoaded,  ///< Дані ще не завантажувались
+    Loading,    ///< Триває завантаження
+    Loaded      ///< Дані завантажено
+};
+
+/**
+ * @struct SourceLoadResult
+ * @brief Результат завантаження одного джерела даних
+ */
+struct SourceLoadResult {
+    std::string source;                 ///< Назва джерела
+    bool success;                       ///< Чи успішне завантаження
+    std::chrono::milliseconds elapsed;  ///< Тривалість завантаження
+};
+
+} // namespace University
+
+#endif // LOADSTATE_H
@@ -0,0 +1,169 @@
+#include "MappedFile.h"
+
+#include <fstream>
+
+#ifdef _WIN32
+    #include <windows.h>
+#else
+    #include <fcntl.h>
+    #include <sys/mman.h>
+    #include <sys/stat.h>
+    #include <unistd.h>
+#endif
+
+using namespace std;
+
+namespace University {
+
+MappedFile::MappedFile()
+    : m_data(nullptr), m_size(0), m_mapped(false)
+#ifdef _WIN32
+    , m_fileHandle(nullptr), m_mappingHandle(nullptr)
+#endif
+{
+}
+
+MappedFile::~MappedFile()
+{
+    Close();
+}
+
+#ifdef _WIN32
+
+bool MappedFile::Open(const string& filename)
+{
+    Close();
+
+    HANDLE file = CreateFileA(filename.c_str(), GENERIC_READ, FILE_SHARE_READ, nullptr,
+                              OPEN_EXISTING, FILE_FLAG_SEQUENTIAL_SCAN, nullptr);
+    if (file == INVALID_HANDLE_VALUE)
+    {
+        return false;
+    }
+
+    LARGE_INTEGER size;
+    if (!GetFileSizeEx(file, &size))
+    {
+        CloseHandle(file);
+        return false;
+    }
+    m_fileHandle = file;
+    m_size = static_cast<size_t>(size.QuadPart);
+
+    // Порожній файл неможливо відобразити, але він коректний
+    if (m_size == 0)
+    {
+        return true;
+    }
+
+    m_mappingHandle = CreateFileMappingA(file, nullptr, PAGE_READONLY, 0, 0, nullptr);
+    if (m_mappingHandle)
+    {
+        m_data = static_cast<const char*>(MapViewOfFile(m_mappingHandle, FILE_MAP_READ, 0, 0, 0));
+    }
+    if (!m_data)
+    {
+        Close();
+        ifstream stream(filename, ios::binary);
+        m_buffer.assign(istreambuf_iterator<char>(stream), istreambuf_iterator<char>());
+        m_data = m_buffer.data();
+        m_size = m_buffer.size();
+        return static_cast<bool>(stream.is_open());
+    }
+    m_mapped = true;
+    return true;
+}
+
+void MappedFile::Close()
+{
+    if (m_mapped && m_data)
+    {
+        UnmapViewOfFile(m_data);
+    }
+    if (m_mappingHandle)
+    {
+        CloseHandle(m_mappingHandle);
+    }
+    if (m_fileHandle)
+    {
+        CloseHandle(m_fileHandle);
+    }
+    m_mappingHandle = nullptr;
+    m_fileHandle = nullptr;
+    m_data = nullptr;
+    m_size = 0;
+    m_mapped = false;
+    m_buffer.clear();
+}
+
+#else
+
+bool MappedFile::Open(const string& filename)
+{
+    Close();
+
+    int fd = open(filename.c_str(), O_RDONLY);
+    if (fd < 0)
+    {
+        return false;
+    }
+
+    struct stat info;
+    if (fstat(fd, &info) != 0)
+    {
+        close(fd);
+        return false;
+    }
+    m_size = static_cast<size_t>(info.st_size);
+
+    // Порожній файл неможливо відобразити, але він коректний
+    if (m_size == 0)
+    {
+        close(fd);
+        return true;
+    }
+
+    void* address = mmap(nullptr, m_size, PROT_READ, MAP_PRIVATE, fd, 0);
+    close(fd);
+
+    if (address == MAP_FAILED)
+    {
+        // Резервний шлях: одне послідовне читання в буфер
+        ifstream stream(filename, ios::binary);
+        if (!stream.is_open())
+        {
+            m_size = 0;
+            return false;
+        }
+        m_buffer.assign(istreambuf_iterator<char>(stream), istreambuf_iterator<char>());
+        m_data = m_buffer.data();
+        m_size = m_buffer.size();
+        return true;
+    }
+
+    madvise(address, m_size, MADV_SEQUENTIAL);
+    m_data = static_cast<const char*>(address);
+    m_mapped = true;
+    return true;
+}
+
+void MappedFile::Close()
+{
+    if (m_mapped && m_data)
+    {
+        munmap(const_cast<char*>(m_data), m_size);
+    }
+    m_data = nullptr;
+    m_size = 0;
+    m_mapped = false;
+    m_buffer.clear();
+}
+
+#endif
+
+string_view MappedFile::GetView() const
+{
+    return m_data ? string_view(m_data, m_size) : string_view();
+}
+
+} // namespace University
@@ -0,0 +1,69 @@
+/**
+ * @file MappedFile.h
+ * @brief Заголовний файл для відображення файлу в пам'ять (read-only)
+ */
+
+#ifndef MAPPEDFILE_H
+#define MAPPEDFILE_H
+
+#include <string>
+#include <string_view>
+
+namespace University {
+
+/**
+ * @class MappedFile
+ * @brief Відображає файл у пам'ять лише для читання
+ *
+ * Дозволяє розбирати файл через std::string_view без копіювання рядків.
+ * Вміст доступний, доки об'єкт існує. Якщо відображення недоступне,
+ * файл зчитується в буфер одним читанням.
+ */
+class MappedFile {
+private:
+    const char* m_data;      ///< Початок даних
+    size_t m_size;           ///< Розмір даних у байтах
+    bool m_mapped;           ///< true якщо дані відображені, false якщо зчитані в буфер
+    std::string m_buffer;    ///< Буфер для резервного читання
+
+#ifdef _WIN32
+    void* m_fileHandle;      ///< Дескриптор файлу
+    void* m_mappingHandle;   ///< Дескриптор відображення
+#endif
+
+public:
+    /**
+     * @brief Конструктор за замовчуванням
+     */
+    MappedFile();
+
+    MappedFile(const MappedFile&) = delete;
+    MappedFile& operator=(const MappedFile&) = delete;
+
+    /**
+     * @brief Деструктор, звільняє відображення
+     */
+    ~MappedFile();
+
+    /**
+     * @brief Відкриває та відображає файл
+     * @param filename Шлях до файлу
+     * @return true якщо успішно, false в іншому випадку
+     */
+    bool Open(const std::string& filename);
+
+    /**
+     * @brief Звільняє відображення
+     */
+    void Close();
+
+    /**
+     * @brief Повертає вміст файлу
+     * @return Представлення вмісту файлу
+     */
+    std::string_view GetView() const;
+};
+
+} // namespace University
+
+#endif // MAPPEDFILE_H
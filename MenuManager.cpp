@@ -3,9 +3,43 @@
 #include <limits>
 #include <sstream>
 
+#include "StartupLoader.h"
+
 using namespace std;
 using namespace University;
 
+namespace {
+
+/**
+ * @brief Виводить записи сторінками, запитуючи продовження між ними
+ * @details Кожна сторінка - представлення тієї самої колекції, записи не копіюються.
+ */
+template <typename Record, typename PrintRecord>
+void PrintPaged(const RecordView<Record>& list, size_t pageSize, PrintRecord printRecord)
+{
+    size_t pageCount = (list.Size() + pageSize - 1) / pageSize;
+    for (size_t page = 0; page < pageCount; page++)
+    {
+        for (const auto& record : list.Page(page * pageSize, pageSize))
+        {
+            printRecord(record);
+        }
+        if (page + 1 < pageCount)
+        {
+            cout << "-- Сторінка " << page + 1 << " з " << pageCount
+                 << " (Enter - далі, q - завершити): ";
+            string answer;
+            getline(cin, answer);
+            if (answer == "q" || answer == "Q")
+            {
+                break;
+            }
+        }
+    }
+}
+
+} // namespace
+
 // Ініціалізація констант для стартового меню
 const string MenuManager::WELCOME_MENU_TITLE =
     "==================================================\n"
@@ -57,6 +91,12 @@ const string MenuManager::SEARCH_SUBJECT_OPTIONS =
     "7. Пошук за назвою\n"
     "8. Фільтрація за семестром\n"
     "9. Сортування за назвою";
+const string MenuManager::SEARCH_QUERY_OPTIONS =
+    "=== СКЛАДЕНІ ЗАПИТИ ===\n"
+    "10. Студенти (програма, ім'я, прізвище)\n"
+    "11. Викладачі (кафедра, ім'я, прізвище)\n"
+    "12. Предмети (назва, семестр, кредити)\n"
+    "13. Предмети з найбільшою кількістю кредитів";
 const string MenuManager::SEARCH_PROMPT = "Оберіть опцію (0 - назад): ";
 
 // Загальні текстові константи
@@ -76,6 +116,10 @@ const string MenuManager::PRESS_ENTER = "\nНатисніть Enter, щоб пр
 const string MenuManager::SEARCH_RESULTS = "РЕЗУЛЬТАТИ ПОШУКУ";
 const string MenuManager::FILTER_RESULTS = "РЕЗУЛЬТАТИ ФІЛЬТРАЦІЇ";
 const string MenuManager::LIST_TITLE = "СПИСОК ЗАПИСІВ";
+const string MenuManager::QUERY_RESULTS = "РЕЗУЛЬТАТИ ЗАПИТУ";
+const string MenuManager::FUZZY_RESULTS = "ТОЧНИХ ЗБІГІВ НЕМАЄ, СХОЖІ РЕЗУЛЬТАТИ";
+const string MenuManager::TOP_CREDITS_TITLE = "ПРЕДМЕТИ З НАЙБІЛЬШОЮ КІЛЬКІСТЮ КРЕДИТІВ";
+const size_t MenuManager::LIST_PAGE_SIZE = 20;
 
 // Поля вводу
 const string MenuManager::INPUT_NAME = "Введіть ім'я: ";
@@ -90,6 +134,7 @@ const string MenuManager::INPUT_SEMESTER = "Введіть семестр: ";
 const string MenuManager::INPUT_TEACHER_ID = "Введіть ID викладача: ";
 const string MenuManager::INPUT_SEARCH_NAME = "Введіть ім'я/назву для пошуку: ";
 const string MenuManager::INPUT_SORT_ORDER = "Порядок сортування (1 - зростання, 0 - спадання): ";
+const string MenuManager::INPUT_TOP_COUNT = "Скільки записів показати: ";
 
 // Конструктори та оператори
 MenuManager::MenuManager(UserManager* userManager, DatabaseManager* dbManager,
@@ -291,34 +336,34 @@ string MenuManager::RoleToString(UserRole role) const
 }
 
 // Методи для виводу списків
-void MenuManager::PrintStudentList(const vector<Student>& list, const string& title) const
+void MenuManager::PrintStudentList(const StudentView& list, const string& title) const
 {
     cout << "\n=== " << title << " ===\n";
-    if (list.empty())
+    if (list.Empty())
     {
         cout << "Студенти відсутні\n";
         return;
     }
-    for (const auto& student : list)
+    PrintPaged(list, LIST_PAGE_SIZE, [](const Student& student)
     {
         cout << "ID: " << student.getStudentID()
              << " | Ім'я: " << student.getName()
              << " " << student.getLastName()
              << " | Email: " << student.getEmail()
              << " | Програма: " << student.getEducationalProgram() << "\n";
-    }
-    cout << "Всього студентів: " << list.size() << "\n";
+    });
+    cout << "Всього студентів: " << list.Size() << "\n";
 }
 
-void MenuManager::PrintTeacherList(const vector<Teacher>& list, const string& title) const
+void MenuManager::PrintTeacherList(const TeacherView& list, const string& title) const
 {
     cout << "\n=== " << title << " ===\n";
-    if (list.empty())
+    if (list.Empty())
     {
         cout << "Викладачі відсутні\n";
         return;
     }
-    for (const auto& teacher : list)
+    PrintPaged(list, LIST_PAGE_SIZE, [](const Teacher& teacher)
     {
         string degreeStr;
         switch (teacher.getAcademicDegree())
@@ -342,27 +387,27 @@ void MenuManager::PrintTeacherList(const vector<Teacher>& list, const string& ti
              << " | Email: " << teacher.getEmail()
              << " | Кафедра: " << teacher.getDepartment()
              << " | Ступінь: " << degreeStr << "\n";
-    }
-    cout << "Всього викладачів: " << list.size() << "\n";
+    });
+    cout << "Всього викладачів: " << list.Size() << "\n";
 }
 
-void MenuManager::PrintSubjectList(const vector<Subject>& list, const string& title) const
+void MenuManager::PrintSubjectList(const SubjectView& list, const string& title) const
 {
     cout << "\n=== " << title << " ===\n";
-    if (list.empty())
+    if (list.Empty())
     {
         cout << "Предмети відсутні\n";
         return;
     }
-    for (const auto& subject : list)
+    PrintPaged(list, LIST_PAGE_SIZE, [](const Subject& subject)
     {
         cout << "ID: " << subject.getSubjectId()
              << " | Назва: " << subject.getSubjectName()
              << " | Кредити: " << subject.getEctsCredits()
              << " | Викладач ID: " << subject.getTeacherId()
              << " | Семестр: " << subject.getSemester() << "\n";
-    }
-    cout << "Всього предметів: " << list.size() << "\n";
+    });
+    cout << "Всього предметів: " << list.Size() << "\n";
 }
 
 // НОВИЙ МЕТОД: Завантаження всіх даних
@@ -372,13 +417,18 @@ void MenuManager::LoadAllData()
     {
         cout << "Завантаження даних з файлів..." << endl;
 
-        // Use the public method instead:
-        m_dbManager->LoadFromFile(FileConstants::STUDENTS_FILE,
-                                 FileConstants::TEACHERS_FILE,
-                                 FileConstants::SUBJECTS_FILE);
-        m_userManager->LoadUsersFromFile(FileConstants::USERS_FILE);
+        // Усі джерела читаються одночасно; меню продовжує роботу лише після завершення всіх
+        StartupLoader loader(m_dbManager, m_userManager, m_assignmentManager);
+        bool success = loader.LoadAll();
+
+        for (const auto& result : loader.GetResults())
+        {
+            cout << "  " << result.source << ": " << result.elapsed.count() << " мс"
+                 << (result.success ? "" : " (помилка)") << endl;
+        }
+        cout << "Загальний час завантаження: " << loader.GetTotalTime().count() << " мс" << endl;
 
-        cout << "Дані успішно завантажені!" << endl;
+        cout << (success ? "Дані успішно завантажені!" : "Дані завантажені з помилками.") << endl;
         PressAnyKey();
     }
 }
@@ -639,15 +689,15 @@ void MenuManager::ShowGenericManagementMenu(const string& title, int type)
             case 1:
                 if (type == 1)
                 {
-                    PrintStudentList(m_dbManager->GetAllStudents(), LIST_TITLE + " - СТУДЕНТИ");
+                    PrintStudentList(m_dbManager->ViewAllStudents(), LIST_TITLE + " - СТУДЕНТИ");
                 }
                 else if (type == 2)
                 {
-                    PrintTeacherList(m_dbManager->GetAllTeachers(), LIST_TITLE + " - ВИКЛАДАЧІ");
+                    PrintTeacherList(m_dbManager->ViewAllTeachers(), LIST_TITLE + " - ВИКЛАДАЧІ");
                 }
                 else if (type == 3)
                 {
-                    PrintSubjectList(m_dbManager->GetAllSubjects(), LIST_TITLE + " - ПРЕДМЕТИ");
+                    PrintSubjectList(m_dbManager->ViewAllSubjects(), LIST_TITLE + " - ПРЕДМЕТИ");
                 }
                 PressAnyKey();
                 break;
@@ -729,10 +779,11 @@ void MenuManager::ShowGenericManagementMenu(const string& title, int type)
                 string id = GetInput("Введіть ID для редагування: ");
                 bool found = false;
 
+                // Дескриптор знаходиться один раз і залишається дійсним, поки вводяться нові дані
                 if (type == 1)
                 {
-                    auto* s = m_dbManager->GetStudent(id);
-                    if (s)
+                    StudentHandle handle = m_dbManager->GetStudentHandle(id);
+                    if (!handle.IsNull())
                     {
                         string name = GetInput("Нове ім'я: ");
                         string last = GetInput("Нове прізвище: ");
@@ -740,15 +791,17 @@ void MenuManager::ShowGenericManagementMenu(const string& title, int type)
                         string program = GetInput("Нова освітня програма: ");
 
                         Student upd(name, last, email, id, program);
-                        m_dbManager->EditStudent(id, upd);
-                        cout << UPDATED_SUCCESS << endl;
-                        found = true;
+                        found = m_dbManager->EditStudent(handle, upd);
+                        if (found)
+                        {
+                            cout << UPDATED_SUCCESS << endl;
+                        }
                     }
                 }
                 else if (type == 2)
                 {
-                    auto* t = m_dbManager->GetTeacher(id);
-                    if (t)
+                    TeacherHandle handle = m_dbManager->GetTeacherHandle(id);
+                    if (!handle.IsNull())
                     {
                         string name = GetInput("Нове ім'я: ");
                         string last = GetInput("Нове прізвище: ");
@@ -760,24 +813,28 @@ void MenuManager::ShowGenericManagementMenu(const string& title, int type)
                                            deg == 3 ? AcademicDegree::DOCTOR :
                                                       AcademicDegree::BACHELOR);
 
-                        m_dbManager->EditTeacher(id, Teacher(name, last, email, id, dept, d));
-                        cout << UPDATED_SUCCESS << endl;
-                        found = true;
+                        found = m_dbManager->EditTeacher(handle, Teacher(name, last, email, id, dept, d));
+                        if (found)
+                        {
+                            cout << UPDATED_SUCCESS << endl;
+                        }
                     }
                 }
                 else if (type == 3)
                 {
-                    auto* s = m_dbManager->GetSubject(id);
-                    if (s)
+                    SubjectHandle handle = m_dbManager->GetSubjectHandle(id);
+                    if (!handle.IsNull())
                     {
                         string name = GetInput("Нова назва: ");
                         int credits = GetIntInput("Нові кредити: ");
                         string teacher = GetInput("Новий ID викладача: ");
                         int sem = GetIntInput("Новий семестр: ");
 
-                        m_dbManager->EditSubject(id, Subject(id, name, credits, teacher, sem));
-                        cout << UPDATED_SUCCESS << endl;
-                        found = true;
+                        found = m_dbManager->EditSubject(handle, Subject(id, name, credits, teacher, sem));
+                        if (found)
+                        {
+                            cout << UPDATED_SUCCESS << endl;
+                        }
                     }
                 }
 
@@ -817,15 +874,15 @@ void MenuManager::ShowGenericManagementMenu(const string& title, int type)
                 string search = GetInput("Введіть ім'я для пошуку: ");
                 if (type == 1)
                 {
-                    PrintStudentList(m_dbManager->SearchStudentsByName(search), SEARCH_RESULTS);
+                    PrintStudentList(m_dbManager->ViewStudentsByName(search), SEARCH_RESULTS);
                 }
                 else if (type == 2)
                 {
-                    PrintTeacherList(m_dbManager->SearchTeachersByName(search), SEARCH_RESULTS);
+                    PrintTeacherList(m_dbManager->ViewTeachersByName(search), SEARCH_RESULTS);
                 }
                 else if (type == 3)
                 {
-                    PrintSubjectList(m_dbManager->SearchSubjectsByName(search), SEARCH_RESULTS);
+                    PrintSubjectList(m_dbManager->ViewSubjectsByName(search), SEARCH_RESULTS);
                 }
                 PressAnyKey();
                 break;
@@ -871,8 +928,7 @@ void MenuManager::ShowAssignmentManagement()
                     string subjectId = GetInput("Введіть ID предмета: ");
 
                     // Перевірка чи існує викладач
-                    Teacher* teacher = m_dbManager->GetTeacher(teacherId);
-                    if (!teacher)
+                    if (m_dbManager->GetTeacherHandle(teacherId).IsNull())
                     {
                         cout << "Помилка: Викладач з ID " << teacherId << " не знайдений!\n";
                         PressAnyKey();
@@ -880,8 +936,7 @@ void MenuManager::ShowAssignmentManagement()
                     }
 
                     // Перевірка чи існує предмет
-                    Subject* subject = m_dbManager->GetSubject(subjectId);
-                    if (!subject)
+                    if (m_dbManager->GetSubjectHandle(subjectId).IsNull())
                     {
                         cout << "Помилка: Предмет з ID " << subjectId << " не знайдений!\n";
                         PressAnyKey();
@@ -900,8 +955,7 @@ void MenuManager::ShowAssignmentManagement()
                     string teacherId = GetInput("Введіть ID викладача для видалення призначення: ");
 
                     // Перевірка чи існує викладач
-                    Teacher* teacher = m_dbManager->GetTeacher(teacherId);
-                    if (!teacher)
+                    if (m_dbManager->GetTeacherHandle(teacherId).IsNull())
                     {
                         cout << "Помилка: Викладач з ID " << teacherId << " не знайдений!\n";
                         PressAnyKey();
@@ -927,8 +981,8 @@ void MenuManager::ShowAssignmentManagement()
                     {
                         for (const auto& assignment : assignments)
                         {
-                            Teacher* teacher = m_dbManager->GetTeacher(assignment.first);
-                            Subject* subject = m_dbManager->GetSubject(assignment.second);
+                            optional<Teacher> teacher = m_dbManager->GetTeacher(assignment.first);
+                            optional<Subject> subject = m_dbManager->GetSubject(assignment.second);
 
                             string teacherName = teacher ? teacher->getFullName() : "Невідомий викладач";
                             string subjectName = subject ? subject->getSubjectName() : "Невідомий предмет";
@@ -944,9 +998,9 @@ void MenuManager::ShowAssignmentManagement()
                 {
                     string teacherId = GetInput("Введіть ID викладача: ");
 
-                    // Перевірка чи існує викладач
-                    Teacher* teacher = m_dbManager->GetTeacher(teacherId);
-                    if (!teacher)
+                    // Перевірка чи існує викладач; дані для виводу потім читаються за дескриптором
+                    TeacherHandle handle = m_dbManager->GetTeacherHandle(teacherId);
+                    if (handle.IsNull())
                     {
                         cout << "Помилка: Викладач з ID " << teacherId << " не знайдений!\n";
                         PressAnyKey();
@@ -958,6 +1012,12 @@ void MenuManager::ShowAssignmentManagement()
                     cout << "Статус: " << status << endl;
 
                     // Додаткова інформація про викладача
+                    optional<Teacher> teacher = m_dbManager->GetTeacher(handle);
+                    if (!teacher)
+                    {
+                        PressAnyKey();
+                        break;
+                    }
                     cout << "\nІнформація про викладача:\n";
                     cout << " - Ім'я: " << teacher->getFullName() << "\n";
                     cout << " - Кафедра: " << teacher->getDepartment() << "\n";
@@ -972,8 +1032,7 @@ void MenuManager::ShowAssignmentManagement()
                     string subjectId = GetInput("Введіть ID предмета: ");
 
                     // Перевірка чи існує студент
-                    Student* student = m_dbManager->GetStudent(studentId);
-                    if (!student)
+                    if (m_dbManager->GetStudentHandle(studentId).IsNull())
                     {
                         cout << "Помилка: Студент з ID " << studentId << " не знайдений!\n";
                         PressAnyKey();
@@ -981,8 +1040,7 @@ void MenuManager::ShowAssignmentManagement()
                     }
 
                     // Перевірка чи існує предмет
-                    Subject* subject = m_dbManager->GetSubject(subjectId);
-                    if (!subject)
+                    if (m_dbManager->GetSubjectHandle(subjectId).IsNull())
                     {
                         cout << "Помилка: Предмет з ID " << subjectId << " не знайдений!\n";
                         PressAnyKey();
@@ -1016,12 +1074,12 @@ void MenuManager::ShowAssignmentManagement()
                 {
                     // ВИПРАВЛЕННЯ: Замінюємо getAllStudentEnrollments на пошук через всіх студентів
                     cout << "\n=== ВСІ ЗАПИСИ СТУДЕНТІВ ===\n";
-                    vector<Student> allStudents = m_dbManager->GetAllStudents();
+                    StudentView allStudents = m_dbManager->ViewAllStudents();
                     bool foundEnrollments = false;
 
                     for (const auto& student : allStudents)
                     {
-                        string studentId = student.getStudentID();
+                        const string& studentId = student.getStudentID();
                         vector<string> studentSubjects = m_assignmentManager->getStudentSubjects(studentId);
 
                         if (!studentSubjects.empty())
@@ -1031,7 +1089,7 @@ void MenuManager::ShowAssignmentManagement()
 
                             for (size_t i = 0; i < studentSubjects.size(); ++i)
                             {
-                                Subject* subject = m_dbManager->GetSubject(studentSubjects[i]);
+                                optional<Subject> subject = m_dbManager->GetSubject(studentSubjects[i]);
                                 string subjectName = subject ? subject->getSubjectName() : "Невідомий предмет";
                                 cout << studentSubjects[i] << " (" << subjectName << ")";
                                 if (i < studentSubjects.size() - 1)
@@ -1075,6 +1133,7 @@ void MenuManager::ShowSearchMenu()
         cout << SEARCH_STUDENT_OPTIONS << "\n\n";
         cout << SEARCH_TEACHER_OPTIONS << "\n\n";
         cout << SEARCH_SUBJECT_OPTIONS << "\n\n";
+        cout << SEARCH_QUERY_OPTIONS << "\n\n";
         cout << "0. Назад до головного меню\n\n";
         cout << SEARCH_PROMPT;
 
@@ -1086,15 +1145,21 @@ void MenuManager::ShowSearchMenu()
             case 1:
             {
                 string name = GetInput(INPUT_SEARCH_NAME);
-                auto results = m_dbManager->SearchStudentsByName(name);
-                PrintStudentList(results, SEARCH_RESULTS + " - Студенти");
+                auto results = m_dbManager->ViewStudentsByName(name);
+                string title = SEARCH_RESULTS + " - Студенти";
+                if (results.Empty())
+                {
+                    results = m_dbManager->ViewStudentsByNameFuzzy(name);
+                    title = FUZZY_RESULTS + " - Студенти";
+                }
+                PrintStudentList(results, title);
                 PressAnyKey();
                 break;
             }
             case 2:
             {
                 string program = GetInput(INPUT_PROGRAM);
-                auto results = m_dbManager->FilterStudentsByProgram(program);
+                auto results = m_dbManager->ViewStudentsByProgram(program);
                 PrintStudentList(results, FILTER_RESULTS + " - Студенти");
                 PressAnyKey();
                 break;
@@ -1109,15 +1174,21 @@ void MenuManager::ShowSearchMenu()
             case 4:
             {
                 string name = GetInput(INPUT_SEARCH_NAME);
-                auto results = m_dbManager->SearchTeachersByName(name);
-                PrintTeacherList(results, SEARCH_RESULTS + " - Викладачі");
+                auto results = m_dbManager->ViewTeachersByName(name);
+                string title = SEARCH_RESULTS + " - Викладачі";
+                if (results.Empty())
+                {
+                    results = m_dbManager->ViewTeachersByNameFuzzy(name);
+                    title = FUZZY_RESULTS + " - Викладачі";
+                }
+                PrintTeacherList(results, title);
                 PressAnyKey();
                 break;
             }
             case 5:
             {
                 string department = GetInput(INPUT_DEPARTMENT);
-                auto results = m_dbManager->FilterTeachersByDepartment(department);
+                auto results = m_dbManager->ViewTeachersByDepartment(department);
                 PrintTeacherList(results, FILTER_RESULTS + " - Викладачі");
                 PressAnyKey();
                 break;
@@ -1132,15 +1203,21 @@ void MenuManager::ShowSearchMenu()
             case 7:
             {
                 string name = GetInput(INPUT_SEARCH_NAME);
-                auto results = m_dbManager->SearchSubjectsByName(name);
-                PrintSubjectList(results, SEARCH_RESULTS + " - Предмети");
+                auto results = m_dbManager->ViewSubjectsByName(name);
+                string title = SEARCH_RESULTS + " - Предмети";
+                if (results.Empty())
+                {
+                    results = m_dbManager->ViewSubjectsByNameFuzzy(name);
+                    title = FUZZY_RESULTS + " - Предмети";
+                }
+                PrintSubjectList(results, title);
                 PressAnyKey();
                 break;
             }
             case 8:
             {
                 int semester = GetIntInput(INPUT_SEMESTER);
-                auto results = m_dbManager->FilterSubjectsBySemester(semester);
+                auto results = m_dbManager->ViewSubjectsBySemester(semester);
                 PrintSubjectList(results, FILTER_RESULTS + " - Предмети");
                 PressAnyKey();
                 break;
@@ -1152,6 +1229,29 @@ void MenuManager::ShowSearchMenu()
                 PressAnyKey();
                 break;
             }
+            case 10:
+                ShowStudentQuery();
+                break;
+            case 11:
+                ShowTeacherQuery();
+                break;
+            case 12:
+                ShowSubjectQuery();
+                break;
+            case 13:
+            {
+                int count = GetIntInput(INPUT_TOP_COUNT);
+                if (count <= 0)
+                {
+                    cout << "Кількість має бути додатною!" << endl;
+                    PressAnyKey();
+                    break;
+                }
+                PrintSubjectList(m_dbManager->ViewTopSubjectsByCredits(static_cast<size_t>(count)),
+                                 TOP_CREDITS_TITLE);
+                PressAnyKey();
+                break;
+            }
             case 0:
                 return;
             default:
@@ -1161,6 +1261,108 @@ void MenuManager::ShowSearchMenu()
     } while (choice != 0);
 }
 
+bool MenuManager::GetQueryOrderAndLimit(bool& ascending, size_t& limit)
+{
+    int order = GetIntInput("Сортування за назвою (1 - А-Я, 2 - Я-А, 0 - без сортування): ");
+    int maxResults = GetIntInput("Максимальна кількість результатів (0 - без обмеження): ");
+    ascending = order != 2;
+    limit = maxResults > 0 ? static_cast<size_t>(maxResults) : StudentQuery::NO_LIMIT;
+    return order == 1 || order == 2;
+}
+
+void MenuManager::ShowStudentQuery()
+{
+    StudentQuery query;
+    string program = GetInput("Програма містить (Enter - пропустити): ");
+    if (!program.empty())
+    {
+        query.Where(StudentField::Program, Match::Contains, program);
+    }
+    string name = GetInput("Ім'я містить (Enter - пропустити): ");
+    if (!name.empty())
+    {
+        query.Where(StudentField::FirstName, Match::Contains, name);
+    }
+    string lastName = GetInput("Прізвище починається з (Enter - пропустити): ");
+    if (!lastName.empty())
+    {
+        query.Where(StudentField::LastName, Match::StartsWith, lastName);
+    }
+
+    bool ascending;
+    size_t limit;
+    if (GetQueryOrderAndLimit(ascending, limit))
+    {
+        query.OrderBy(StudentField::FullName, ascending);
+    }
+    query.Limit(limit);
+
+    PrintStudentList(m_dbManager->RunQuery(query), QUERY_RESULTS + " - Студенти");
+    PressAnyKey();
+}
+
+void MenuManager::ShowTeacherQuery()
+{
+    TeacherQuery query;
+    string department = GetInput("Кафедра містить (Enter - пропустити): ");
+    if (!department.empty())
+    {
+        query.Where(TeacherField::Department, Match::Contains, department);
+    }
+    string name = GetInput("Ім'я містить (Enter - пропустити): ");
+    if (!name.empty())
+    {
+        query.Where(TeacherField::FirstName, Match::Contains, name);
+    }
+    string lastName = GetInput("Прізвище починається з (Enter - пропустити): ");
+    if (!lastName.empty())
+    {
+        query.Where(TeacherField::LastName, Match::StartsWith, lastName);
+    }
+
+    bool ascending;
+    size_t limit;
+    if (GetQueryOrderAndLimit(ascending, limit))
+    {
+        query.OrderBy(TeacherField::FullName, ascending);
+    }
+    query.Limit(limit);
+
+    PrintTeacherList(m_dbManager->RunQuery(query), QUERY_RESULTS + " - Викладачі");
+    PressAnyKey();
+}
+
+void MenuManager::ShowSubjectQuery()
+{
+    SubjectQuery query;
+    string name = GetInput("Назва містить (Enter - пропустити): ");
+    if (!name.empty())
+    {
+        query.Where(SubjectField::Name, Match::Contains, name);
+    }
+    int semester = GetIntInput("Семестр (0 - будь-який): ");
+    if (semester > 0)
+    {
+        query.Where(SubjectField::Semester, Match::Equals, semester);
+    }
+    int minCredits = GetIntInput("Мінімум кредитів (0 - без обмеження): ");
+    if (minCredits > 0)
+    {
+        query.Where(SubjectField::Credits, Match::Greater, minCredits - 1);
+    }
+
+    bool ascending;
+    size_t limit;
+    if (GetQueryOrderAndLimit(ascending, limit))
+    {
+        query.OrderBy(SubjectField::Name, ascending);
+    }
+    query.Limit(limit);
+
+    PrintSubjectList(m_dbManager->RunQuery(query), QUERY_RESULTS + " - Предмети");
+    PressAnyKey();
+}
+
 void MenuManager::ShowHelp()
 {
     ClearScreen();
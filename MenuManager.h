@@ -164,25 +164,25 @@ public:
     // === МЕТОДИ ДЛЯ ВИВОДУ СПИСКІВ ===
 
     /**
-     * @brief Виводить список студентів
+     * @brief Виводить список студентів посторінково
      * @param list Список студентів
      * @param title Заголовок списку
      */
-    void PrintStudentList(const std::vector<Student>& list, const std::string& title) const;
+    void PrintStudentList(const StudentView& list, const std::string& title) const;
 
     /**
-     * @brief Виводить список викладачів
+     * @brief Виводить список викладачів посторінково
      * @param list Список викладачів
      * @param title Заголовок списку
      */
-    void PrintTeacherList(const std::vector<Teacher>& list, const std::string& title) const;
+    void PrintTeacherList(const TeacherView& list, const std::string& title) const;
 
     /**
-     * @brief Виводить список предметів
+     * @brief Виводить список предметів посторінково
      * @param list Список предметів
      * @param title Заголовок списку
      */
-    void PrintSubjectList(const std::vector<Subject>& list, const std::string& title) const;
+    void PrintSubjectList(const SubjectView& list, const std::string& title) const;
 
     // === ЗАВАНТАЖЕННЯ ДАНИХ ===
 
@@ -240,6 +240,29 @@ public:
      */
     void ShowSearchMenu();
 
+    /**
+     * @brief Збирає та виконує складений запит до студентів
+     */
+    void ShowStudentQuery();
+
+    /**
+     * @brief Збирає та виконує складений запит до викладачів
+     */
+    void ShowTeacherQuery();
+
+    /**
+     * @brief Збирає та виконує складений запит до предметів
+     */
+    void ShowSubjectQuery();
+
+    /**
+     * @brief Запитує порядок і ліміт результатів складеного запиту
+     * @param ascending Напрям сортування (якщо обрано)
+     * @param limit Ліміт (Query::NO_LIMIT, якщо не задано)
+     * @return true якщо обрано сортування
+     */
+    bool GetQueryOrderAndLimit(bool& ascending, size_t& limit);
+
     /**
      * @brief Відображає довідку по системі
      */
@@ -289,6 +312,7 @@ public:
     static const std::string SEARCH_STUDENT_OPTIONS;      ///< Опції пошуку студентів
     static const std::string SEARCH_TEACHER_OPTIONS;      ///< Опції пошуку викладачів
     static const std::string SEARCH_SUBJECT_OPTIONS;      ///< Опції пошуку предметів
+    static const std::string SEARCH_QUERY_OPTIONS;        ///< Опції складених запитів
     static const std::string SEARCH_PROMPT;               ///< Запит меню пошуку
 
     // Загальні повідомлення
@@ -308,6 +332,10 @@ public:
     static const std::string SEARCH_RESULTS;              ///< Заголовок результатів пошуку
     static const std::string FILTER_RESULTS;              ///< Заголовок результатів фільтрації
     static const std::string LIST_TITLE;                  ///< Заголовок списку
+    static const std::string QUERY_RESULTS;               ///< Заголовок результатів складеного запиту
+    static const std::string FUZZY_RESULTS;               ///< Заголовок результатів нечіткого пошуку
+    static const std::string TOP_CREDITS_TITLE;           ///< Заголовок предметів з найбільшою кількістю кредитів
+    static const size_t LIST_PAGE_SIZE;                   ///< Кількість записів на сторінці списку
 
     // Поля вводу
     static const std::string INPUT_NAME;                  ///< Запит імені
@@ -322,6 +350,7 @@ public:
     static const std::string INPUT_TEACHER_ID;            ///< Запит ID викладача
     static const std::string INPUT_SEARCH_NAME;           ///< Запит для пошуку
     static const std::string INPUT_SORT_ORDER;            ///< Запит порядку сортування
+    static const std::string INPUT_TOP_COUNT;             ///< Запит кількості перших записів
 };
 
 } // namespace University
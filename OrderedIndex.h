@@ -0,0 +1,138 @@
+/**
+ * @file OrderedIndex.h
+ * @brief Заголовний файл для впорядкованого індексу записів за ключем
+ */
+
+#ifndef ORDEREDINDEX_H
+#define ORDEREDINDEX_H
+
+#include "SlotMap.h"
+#include <functional>
+#include <set>
+#include <type_traits>
+#include <utility>
+
+namespace University {
+
+/**
+ * @class OrderedIndex
+ * @brief Підтримує записи колекції впорядкованими за ключем
+ *
+ * Зберігає дескриптори записів у збалансованому дереві, тож додавання та
+ * видалення запису коштують O(log n), а обхід у прямому чи зворотному
+ * порядку - O(n) без сортування та без зміни порядку самої колекції.
+ * Ключі не копіюються: функція порівняння читає поточні поля записів з
+ * таблиці колекції. Тому запис додається, коли його рядок уже в таблиці,
+ * а видаляється до зміни чи видалення рядка. Записи з однаковим ключем
+ * упорядковуються за номером слота.
+ *
+ * @tparam T Тип запису
+ */
+template <typename T>
+class OrderedIndex {
+public:
+    /// Порівнює ключі двох записів: від'ємне, нуль чи додатне значення
+    using CompareFunction = std::function<int(Handle<T>, Handle<T>)>;
+
+private:
+    /**
+     * @struct Less
+     * @brief Порядок дескрипторів у дереві
+     */
+    struct Less {
+        CompareFunction compare;  ///< Порівняння ключів записів
+
+        bool operator()(Handle<T> left, Handle<T> right) const
+        {
+            int order = compare(left, right);
+            if (order != 0)
+            {
+                return order < 0;
+            }
+            return left.slot < right.slot;
+        }
+    };
+
+    std::set<Handle<T>, Less> m_entries;  ///< Дескриптори в порядку зростання ключа
+
+    template <typename Iterator, typename Visitor>
+    static void Walk(Iterator first, Iterator last, Visitor& visit)
+    {
+        for (; first != last; ++first)
+        {
+            if constexpr (std::is_same_v<decltype(visit(*first)), bool>)
+            {
+                if (!visit(*first))
+                {
+                    return;
+                }
+            }
+            else
+            {
+                visit(*first);
+            }
+        }
+    }
+
+public:
+    /**
+     * @brief Конструктор з параметрами
+     * @param compare Функція, що порівнює ключі записів за їхніми дескрипторами
+     */
+    explicit OrderedIndex(CompareFunction compare) : m_entries(Less{std::move(compare)}) {}
+
+    /**
+     * @brief Додає запис до індексу (рядок запису вже в таблиці)
+     */
+    void Insert(const T&, Handle<T> handle)
+    {
+        m_entries.insert(handle);
+    }
+
+    /**
+     * @brief Видаляє запис з індексу (рядок запису ще не змінено)
+     */
+    void Erase(const T&, Handle<T> handle)
+    {
+        m_entries.erase(handle);
+    }
+
+    /**
+     * @brief Очищає індекс
+     */
+    void Clear()
+    {
+        m_entries.clear();
+    }
+
+    /**
+     * @brief Обходить дескриптори записів у порядку ключа
+     * @details Якщо функція повертає bool, обхід припиняється, щойно вона поверне false.
+     * @param ascending true - за зростанням, false - за спаданням
+     * @param visit Функція, що викликається для кожного дескриптора
+     */
+    template <typename Visitor>
+    void ForEach(bool ascending, Visitor visit) const
+    {
+        if (ascending)
+        {
+            Walk(m_entries.begin(), m_entries.end(), visit);
+        }
+        else
+        {
+            Walk(m_entries.rbegin(), m_entries.rend(), visit);
+        }
+    }
+
+    /**
+     * @brief Повертає кількість проіндексованих записів
+     */
+    size_t Size() const
+    {
+        return m_entries.size();
+    }
+};
+
+} // namespace University
+
+#endif // ORDEREDINDEX_H
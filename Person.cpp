@@ -1,4 +1,5 @@
 #include "Person.h"
+#include "EmailValidator.h"
 #include <iostream>
 #include <algorithm>
 #include <cctype>
@@ -10,34 +11,32 @@ using namespace std;
 
 namespace University {
 
-bool Person::ukrainianSupportInitialized = false;
+once_flag Person::ukrainianSupportFlag;
 
 void Person::initializeUkrainianSupport()
 {
-    if (ukrainianSupportInitialized)
+    call_once(ukrainianSupportFlag, []()
     {
-        return;
-    }
 #ifdef _WIN32
-    SetConsoleOutputCP(CP_UTF8);
-    SetConsoleCP(CP_UTF8);
+        SetConsoleOutputCP(CP_UTF8);
+        SetConsoleCP(CP_UTF8);
 #endif
-    try
-    {
-        setlocale(LC_ALL, "uk_UA.UTF-8");
-    }
-    catch (...)
-    {
         try
         {
-            setlocale(LC_ALL, "C.UTF-8");
+            setlocale(LC_ALL, "uk_UA.UTF-8");
         }
         catch (...)
         {
-            setlocale(LC_ALL, "");
+            try
+            {
+                setlocale(LC_ALL, "C.UTF-8");
+            }
+            catch (...)
+            {
+                setlocale(LC_ALL, "");
+            }
         }
-    }
-    ukrainianSupportInitialized = true;
+    });
 }
 
 void Person::validateData() const
@@ -56,51 +55,64 @@ void Person::validateData() const
     }
 }
 
-Person::Person() : name(""), lastName(""), email("")
+Person::Person() : name(""), lastName(""), email(""), fullName(" ")
 {
     initializeUkrainianSupport();
 }
 
 Person::Person(const string& name, const string& lastName, const string& email)
-    : name(name), lastName(lastName), email(email)
+    : name(name), lastName(lastName), email(email), fullName(name + " " + lastName)
 {
     initializeUkrainianSupport();
     validateData();
 }
 
+Person::Person(TrustedData, const string& name, const string& lastName, const string& email)
+    : name(name), lastName(lastName), email(email), fullName(name + " " + lastName)
+{
+    initializeUkrainianSupport();
+}
+
 Person::Person(const Person& other)
-    : name(other.name), lastName(other.lastName), email(other.email)
+    : name(other.name), lastName(other.lastName), email(other.email), fullName(other.fullName)
 {
 }
 
 Person::Person(Person&& other) noexcept
-    : name(move(other.name)), lastName(move(other.lastName)), email(move(other.email))
+    : name(move(other.name)), lastName(move(other.lastName)), email(move(other.email)),
+      fullName(move(other.fullName))
 {
 }
 
 Person::~Person()
 {
-    cout << "Об'єкт Person знищено: " << name << " " << lastName << endl;
 }
 
-string Person::getName() const
+const string& Person::getName() const
 {
     return name;
 }
 
-string Person::getLastName() const
+const string& Person::getLastName() const
 {
     return lastName;
 }
 
-string Person::getEmail() const
+const string& Person::getEmail() const
 {
     return email;
 }
 
-string Person::getFullName() const
+const string& Person::getFullName() const
+{
+    return fullName;
+}
+
+void Person::updateFullName()
 {
-    return name + " " + lastName;
+    fullName.clear();
+    fullName.reserve(name.size() + 1 + lastName.size());
+    fullName.append(name).append(1, ' ').append(lastName);
 }
 
 void Person::setName(const string& name)
@@ -110,6 +122,7 @@ void Person::setName(const string& name)
         throw invalid_argument("Некоректне ім'я: " + name);
     }
     this->name = name;
+    updateFullName();
 }
 
 void Person::setLastName(const string& lastName)
@@ -119,6 +132,7 @@ void Person::setLastName(const string& lastName)
         throw invalid_argument("Некоректне прізвище: " + lastName);
     }
     this->lastName = lastName;
+    updateFullName();
 }
 
 void Person::setEmail(const string& email)
@@ -146,8 +160,7 @@ bool Person::validateEmail(const string& email)
     {
         return false;
     }
-    regex pattern(R"([a-zA-Z0-9._%+-]+@[a-zA-Z0-9.-]+\.[a-zA-Z]{2,})");
-    return regex_match(email, pattern);
+    return EmailValidator::IsValid(email);
 }
 
 bool Person::validateName(const string& name)
@@ -169,6 +182,7 @@ Person& Person::operator=(const Person& other)
         name = other.name;
         lastName = other.lastName;
         email = other.email;
+        fullName = other.fullName;
     }
     return *this;
 }
@@ -180,6 +194,7 @@ Person& Person::operator=(Person&& other) noexcept
         name = move(other.name);
         lastName = move(other.lastName);
         email = move(other.email);
+        fullName = move(other.fullName);
     }
     return *this;
 }
@@ -6,8 +6,10 @@
 #ifndef PERSON_H
 #define PERSON_H
 
+#include <mutex>
 #include <string>
-#include <regex>
+
+#include "TrustedData.h"
 
 namespace University {
 
@@ -22,12 +24,8 @@ namespace University {
         std::string name;                    ///< Ім'я особи
         std::string lastName;                ///< Прізвище особи
         std::string email;                   ///< Електронна пошта
-        static bool ukrainianSupportInitialized; ///< Прапори ініціалізації української мови
-
-        /**
-         * @brief Ініціалізує підтримку української мови
-         */
-        void initializeUkrainianSupport();
+        std::string fullName;                ///< "Ім'я Прізвище" (оновлюється разом з ім'ям і прізвищем)
+        static std::once_flag ukrainianSupportFlag; ///< Прапор одноразової ініціалізації української мови
 
         /**
          * @brief Валідує дані особи
@@ -35,12 +33,25 @@ namespace University {
          */
         void validateData() const;
 
+        /**
+         * @brief Оновлює збережене повне ім'я після зміни імені чи прізвища
+         */
+        void updateFullName();
+
     protected:
         static const int MIN_NAME_LENGTH = 2;   ///< Мінімальна довжина імені
         static const int MAX_NAME_LENGTH = 50;  ///< Максимальна довжина імені
         static const int MIN_EMAIL_LENGTH = 5;  ///< Мінімальна довжина email
 
     public:
+        /**
+         * @brief Ініціалізує підтримку української мови
+         * @details Налаштування локалі виконується один раз за процес. Викликайте
+         * до паралельного створення об'єктів: setlocale не можна виконувати,
+         * поки інші потоки перевіряють символи (isalnum, isalpha).
+         */
+        static void initializeUkrainianSupport();
+
         /**
          * @brief Конструктор за замовчуванням
          */
@@ -54,6 +65,14 @@ namespace University {
          */
         Person(const std::string& name, const std::string& lastName, const std::string& email);
 
+        /**
+         * @brief Конструктор з вже перевіреними даними (без валідації)
+         * @param name Ім'я
+         * @param lastName Прізвище
+         * @param email Електронна пошта
+         */
+        Person(TrustedData, const std::string& name, const std::string& lastName, const std::string& email);
+
         /**
          * @brief Конструктор копіювання
          * @param other Об'єкт для копіювання
@@ -71,11 +90,11 @@ namespace University {
          */
         virtual ~Person();
 
-        // Гетери
-        std::string getName() const;
-        std::string getLastName() const;
-        std::string getEmail() const;
-        std::string getFullName() const;
+        // Гетери (посилання дійсні, доки існує об'єкт і поле не змінено)
+        const std::string& getName() const;
+        const std::string& getLastName() const;
+        const std::string& getEmail() const;
+        const std::string& getFullName() const;
 
         // Сетери
         void setName(const std::string& name);
@@ -0,0 +1,168 @@
+/**
+ * @file Query.h
+ * @brief Заголовний файл для складених запитів до бази даних
+ */
+
+#ifndef QUERY_H
+#define QUERY_H
+
+#include <charconv>
+#include <string>
+#include <vector>
+
+namespace University {
+
+/**
+ * @enum StudentField
+ * @brief Поля студента, доступні в запитах
+ */
+enum class StudentField {
+    Id,          ///< ID студента
+    FirstName,   ///< Ім'я
+    LastName,    ///< Прізвище
+    FullName,    ///< Повне ім'я
+    Email,       ///< Email
+    Program      ///< Освітня програма
+};
+
+/**
+ * @enum TeacherField
+ * @brief Поля викладача, доступні в запитах
+ */
+enum class TeacherField {
+    Id,          ///< ID викладача
+    FirstName,   ///< Ім'я
+    LastName,    ///< Прізвище
+    FullName,    ///< Повне ім'я
+    Email,       ///< Email
+    Department   ///< Кафедра
+};
+
+/**
+ * @enum SubjectField
+ * @brief Поля предмета, доступні в запитах
+ */
+enum class SubjectField {
+    Id,          ///< ID предмета
+    Name,        ///< Назва
+    TeacherId,   ///< ID викладача
+    Credits,     ///< Кредити ECTS (число)
+    Semester     ///< Семестр (число)
+};
+
+/**
+ * @enum Match
+ * @brief Спосіб порівняння поля зі значенням
+ *
+ * Текстові поля порівнюються без урахування регістру, числові - як числа.
+ */
+enum class Match {
+    Equals,      ///< Дорівнює
+    Contains,    ///< Містить
+    StartsWith,  ///< Починається з
+    Less,        ///< Менше
+    Greater      ///< Більше
+};
+
+/**
+ * @struct Condition
+ * @brief Умова запиту для одного поля
+ * @tparam Field Перелік полів сутності
+ */
+template <typename Field>
+struct Condition {
+    Field field;        ///< Поле
+    Match match;        ///< Спосіб порівняння
+    std::string text;   ///< Значення для текстового поля
+    int number;         ///< Значення для числового поля
+    bool hasNumber;     ///< Чи є text цілим числом (інакше умова на числове поле некоректна)
+};
+
+/**
+ * @class Query
+ * @brief Складений запит: умови (поєднані через "І"), порядок та обмеження кількості
+ *
+ * Приклад:
+ * @code
+ * StudentQuery query;
+ * query.Where(StudentField::Program, Match::Contains, "комп")
+ *      .Where(StudentField::LastName, Match::StartsWith, "Ш")
+ *      .OrderBy(StudentField::FullName)
+ *      .Limit(20);
+ * StudentView result = db.RunQuery(query);
+ * @endcode
+ *
+ * @tparam Field Перелік полів сутності
+ */
+template <typename Field>
+class Query {
+private:
+    std::vector<Condition<Field>> m_conditions;  ///< Умови
+    Field m_orderField{};                        ///< Поле впорядкування
+    bool m_ordered = false;                      ///< Чи задано впорядкування
+    bool m_ascending = true;                     ///< Напрям впорядкування
+    size_t m_limit = NO_LIMIT;                   ///< Максимальна кількість результатів
+
+public:
+    static constexpr size_t NO_LIMIT = static_cast<size_t>(-1);
+
+    /**
+     * @brief Додає умову для текстового поля
+     * @details Для числового поля значення розбирається як ціле число;
+     * нечислове значення числового поля відхиляє RunQuery
+     */
+    Query& Where(Field field, Match match, std::string value)
+    {
+        int number = 0;
+        const char* end = value.data() + value.size();
+        auto [parsed, error] = std::from_chars(value.data(), end, number);
+        bool hasNumber = error == std::errc() && parsed == end && !value.empty();
+        m_conditions.push_back(Condition<Field>{field, match, std::move(value), hasNumber ? number : 0, hasNumber});
+        return *this;
+    }
+
+    /**
+     * @brief Додає умову для числового поля
+     */
+    Query& Where(Field field, Match match, int value)
+    {
+        m_conditions.push_back(Condition<Field>{field, match, std::to_string(value), value, true});
+        return *this;
+    }
+
+    /**
+     * @brief Задає впорядкування результатів
+     * @param field Поле впорядкування
+     * @param ascending true - за зростанням, false - за спаданням
+     */
+    Query& OrderBy(Field field, bool ascending = true)
+    {
+        m_orderField = field;
+        m_ordered = true;
+        m_ascending = ascending;
+        return *this;
+    }
+
+    /**
+     * @brief Обмежує кількість результатів
+     */
+    Query& Limit(size_t limit)
+    {
+        m_limit = limit;
+        return *this;
+    }
+
+    const std::vector<Condition<Field>>& GetConditions() const { return m_conditions; }
+    bool IsOrdered() const { return m_ordered; }
+    Field GetOrderField() const { return m_orderField; }
+    bool IsAscending() const { return m_ascending; }
+    size_t GetLimit() const { return m_limit; }
+};
+
+using StudentQuery = Query<StudentField>;  ///< Запит до студентів
+using TeacherQuery = Query<TeacherField>;  ///< Запит до викладачів
+using SubjectQuery = Query<SubjectField>;  ///< Запит до предметів
+
+} // namespace University
+
+#endif // QUERY_H
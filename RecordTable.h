@@ -0,0 +1,217 @@
+/**
+ * @file RecordTable.h
+ * @brief Заголовний файл для плоского сховища записів колекції
+ */
+
+#ifndef RECORDTABLE_H
+#define RECORDTABLE_H
+
+#include "StringPool.h"
+#include <cstddef>
+#include <cstdint>
+#include <string_view>
+#include <vector>
+
+namespace University {
+
+/**
+ * @struct RowLayout
+ * @brief Плоский формат запису колекції (спеціалізації - в EntityRows.h)
+ *
+ * Спеціалізація визначає тип Row без вказівників та функції:
+ * Encode(record, strings) - рядок таблиці з запису,
+ * Decode(row, strings) - запис з рядка таблиці,
+ * GetId(row, strings) - ID запису без створення об'єкта,
+ * IdOf(record) - ID готового запису.
+ *
+ * @tparam Record Тип запису
+ */
+template <typename Record>
+struct RowLayout;
+
+/**
+ * @class RecordTable
+ * @brief Колекція записів у вигляді щільного масиву плоских рядків
+ *
+ * Рядок таблиці містить лише числа: короткі ID зберігаються в самому рядку,
+ * текстові поля - номерами в пулі рядків таблиці, категоріальні - символами
+ * SymbolTable. Об'єкти записів створюються лише під час видачі назовні
+ * (Get), а перегляд полів для пошуку та серіалізації читає рядки напряму.
+ *
+ * Видалення переносить на звільнену позицію останній рядок, як і в SlotMap.
+ * Рядки пулу, що лишилися від змінених і видалених записів, звільняються
+ * перебудовою пулу, коли таких змін стає більше, ніж рядків у таблиці.
+ *
+ * @tparam Record Тип запису
+ */
+template <typename Record>
+class RecordTable {
+public:
+    using Layout = RowLayout<Record>;
+    using Row = typename Layout::Row;
+
+private:
+    std::vector<Row> m_rows;   ///< Рядки таблиці
+    StringPool m_strings;      ///< Текстові поля всіх рядків
+    size_t m_releasedCount;    ///< Замінено чи видалено рядків з моменту останньої перебудови пулу
+
+    void Release()
+    {
+        m_releasedCount++;
+        if (m_releasedCount > m_rows.size())
+        {
+            Compact();
+        }
+    }
+
+    void Compact()
+    {
+        RecordTable compacted;
+        compacted.Reserve(m_rows.size());
+        for (const auto& row : m_rows)
+        {
+            compacted.Append(Layout::Decode(row, m_strings));
+        }
+        *this = std::move(compacted);
+    }
+
+public:
+    RecordTable() : m_releasedCount(0) {}
+
+    /**
+     * @brief Повертає кількість записів
+     */
+    size_t Size() const
+    {
+        return m_rows.size();
+    }
+
+    /**
+     * @brief Перевіряє, чи порожня таблиця
+     */
+    bool Empty() const
+    {
+        return m_rows.empty();
+    }
+
+    /**
+     * @brief Створює об'єкт запису з рядка таблиці
+     * @param position Позиція запису
+     */
+    Record Get(size_t position) const
+    {
+        return Layout::Decode(m_rows[position], m_strings);
+    }
+
+    /**
+     * @brief Повертає ID запису без створення об'єкта
+     * @details Рядок дійсний до наступної зміни таблиці
+     * @param position Позиція запису
+     */
+    std::string_view GetId(size_t position) const
+    {
+        return Layout::GetId(m_rows[position], m_strings);
+    }
+
+    /**
+     * @brief Повертає рядок таблиці для читання окремих полів
+     * @param position Позиція запису
+     */
+    const Row& GetRow(size_t position) const
+    {
+        return m_rows[position];
+    }
+
+    /**
+     * @brief Повертає текстове поле рядка за номером у пулі
+     * @details Рядок дійсний до наступної зміни таблиці
+     * @param text Номер рядка в пулі (поле Row)
+     */
+    std::string_view GetText(uint32_t text) const
+    {
+        return m_strings.Get(text);
+    }
+
+    /**
+     * @brief Повертає текстове поле рядка в нижньому регістрі
+     * @details Лише для полів, що зберігаються разом із варіантом у нижньому
+     * регістрі (див. EntityRows.cpp). Рядок дійсний до наступної зміни таблиці
+     * @param text Номер рядка в пулі (поле Row)
+     */
+    std::string_view GetFoldedText(uint32_t text) const
+    {
+        return m_strings.GetFolded(text);
+    }
+
+    /**
+     * @brief Додає запис у кінець таблиці
+     * @param record Запис
+     */
+    void Append(const Record& record)
+    {
+        m_rows.push_back(Layout::Encode(record, m_strings));
+    }
+
+    /**
+     * @brief Замінює запис на позиції
+     * @param position Позиція запису
+     * @param record Нові дані
+     */
+    void Set(size_t position, const Record& record)
+    {
+        m_rows[position] = Layout::Encode(record, m_strings);
+        Release();
+    }
+
+    /**
+     * @brief Видаляє запис, переносячи на його позицію останній запис
+     * @param position Позиція запису
+     */
+    void Erase(size_t position)
+    {
+        if (position + 1 != m_rows.size())
+        {
+            m_rows[position] = m_rows.back();
+        }
+        m_rows.pop_back();
+        Release();
+    }
+
+    /**
+     * @brief Переставляє записи (наприклад, після сортування)
+     * @param order order[i] - попередня позиція запису, що тепер стоїть на позиції i
+     */
+    void Permute(const std::vector<size_t>& order)
+    {
+        std::vector<Row> rows;
+        rows.reserve(order.size());
+        for (size_t position : order)
+        {
+            rows.push_back(m_rows[position]);
+        }
+        m_rows = std::move(rows);
+    }
+
+    /**
+     * @brief Резервує місце під очікувану кількість записів
+     * @param count Кількість записів
+     */
+    void Reserve(size_t count)
+    {
+        m_rows.reserve(count);
+    }
+
+    /**
+     * @brief Видаляє всі записи
+     */
+    void Clear()
+    {
+        m_rows.clear();
+        m_strings.Clear();
+        m_releasedCount = 0;
+    }
+};
+
+} // namespace University
+
+#endif // RECORDTABLE_H
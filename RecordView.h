@@ -0,0 +1,159 @@
+/**
+ * @file RecordView.h
+ * @brief Заголовний файл для представлення записів колекції
+ */
+
+#ifndef RECORDVIEW_H
+#define RECORDVIEW_H
+
+#include "RecordTable.h"
+#include <algorithm>
+#include <iterator>
+#include <memory>
+#include <vector>
+
+namespace University {
+
+/**
+ * @class RecordView
+ * @brief Представлення записів колекції (усіх або вибраних)
+ *
+ * Містить вказівник на таблицю колекції та, для результатів пошуку, спільний
+ * список позицій знайдених записів. Page() повертає частину представлення
+ * з тим самим списком позицій, тож сторінка будь-якого результату
+ * отримується за O(1). Записи не копіюються наперед: кожне звернення
+ * (operator[], розіменування ітератора) декодує рядок таблиці в новий
+ * об'єкт T. Представлення дійсне, доки колекцію не змінено.
+ *
+ * @tparam T Тип запису
+ */
+template <typename T>
+class RecordView {
+private:
+    const RecordTable<T>* m_records;                         ///< Колекція
+    std::shared_ptr<const std::vector<size_t>> m_positions;  ///< Позиції записів (nullptr - уся колекція)
+    size_t m_begin;                                          ///< Початок представлення
+    size_t m_end;                                            ///< Кінець представлення
+
+    RecordView(const RecordTable<T>* records, std::shared_ptr<const std::vector<size_t>> positions,
+               size_t begin, size_t end)
+        : m_records(records), m_positions(std::move(positions)), m_begin(begin), m_end(end)
+    {
+    }
+
+public:
+    /**
+     * @class Iterator
+     * @brief Ітератор записів представлення
+     */
+    class Iterator {
+    private:
+        const RecordView* m_view;  ///< Представлення
+        size_t m_index;            ///< Номер запису в представленні
+
+    public:
+        using iterator_category = std::forward_iterator_tag;
+        using value_type = T;
+        using difference_type = std::ptrdiff_t;
+        using pointer = void;
+        using reference = T;
+
+        Iterator(const RecordView* view, size_t index) : m_view(view), m_index(index) {}
+
+        T operator*() const { return (*m_view)[m_index]; }
+
+        Iterator& operator++()
+        {
+            m_index++;
+            return *this;
+        }
+
+        bool operator==(const Iterator& other) const { return m_index == other.m_index; }
+        bool operator!=(const Iterator& other) const { return m_index != other.m_index; }
+    };
+
+    /**
+     * @brief Конструктор порожнього представлення
+     */
+    RecordView() : m_records(nullptr), m_begin(0), m_end(0) {}
+
+    /**
+     * @brief Представлення всієї колекції
+     * @param records Колекція
+     */
+    explicit RecordView(const RecordTable<T>& records)
+        : m_records(&records), m_begin(0), m_end(records.Size())
+    {
+    }
+
+    /**
+     * @brief Представлення вибраних записів колекції
+     * @param records Колекція
+     * @param positions Позиції записів у порядку відображення
+     */
+    RecordView(const RecordTable<T>& records, std::vector<size_t> positions)
+        : m_records(&records), m_begin(0), m_end(positions.size())
+    {
+        m_positions = std::make_shared<const std::vector<size_t>>(std::move(positions));
+    }
+
+    /**
+     * @brief Повертає кількість записів у представленні
+     */
+    size_t Size() const
+    {
+        return m_end - m_begin;
+    }
+
+    /**
+     * @brief Перевіряє, чи порожнє представлення
+     */
+    bool Empty() const
+    {
+        return m_begin == m_end;
+    }
+
+    /**
+     * @brief Декодує запис за номером у представленні
+     * @return Новий об'єкт запису (кожен виклик створює його заново)
+     */
+    T operator[](size_t index) const
+    {
+        size_t position = m_positions ? (*m_positions)[m_begin + index] : m_begin + index;
+        return m_records->Get(position);
+    }
+
+    /**
+     * @brief Повертає сторінку представлення (спільний список позицій, без декодування записів)
+     * @param offset Номер першого запису сторінки
+     * @param limit Максимальна кількість записів на сторінці
+     * @return Представлення записів сторінки (порожнє, якщо offset за межами)
+     */
+    RecordView Page(size_t offset, size_t limit) const
+    {
+        size_t begin = m_begin + std::min(offset, Size());
+        size_t end = begin + std::min(limit, m_end - begin);
+        return RecordView(m_records, m_positions, begin, end);
+    }
+
+    /**
+     * @brief Копіює записи представлення у вектор
+     */
+    std::vector<T> ToVector() const
+    {
+        std::vector<T> result;
+        result.reserve(Size());
+        for (size_t i = 0; i < Size(); i++)
+        {
+            result.push_back((*this)[i]);
+        }
+        return result;
+    }
+
+    Iterator begin() const { return Iterator(this, 0); }
+    Iterator end() const { return Iterator(this, Size()); }
+};
+
+} // namespace University
+
+#endif // RECORDVIEW_H
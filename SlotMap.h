@@ -0,0 +1,208 @@
+/**
+ * @file SlotMap.h
+ * @brief Заголовний файл для стабільних дескрипторів записів (slot map)
+ */
+
+#ifndef SLOTMAP_H
+#define SLOTMAP_H
+
+#include <cstdint>
+#include <vector>
+
+namespace University {
+
+/**
+ * @struct Handle
+ * @brief Стабільний дескриптор запису колекції
+ *
+ * Складається з номера слота та покоління. Після видалення запису
+ * покоління слота збільшується, тож старий дескриптор стає недійсним,
+ * навіть якщо слот використано повторно.
+ *
+ * @tparam T Тип запису (лише для розрізнення дескрипторів різних колекцій)
+ */
+template <typename T>
+struct Handle {
+    static constexpr uint32_t NULL_SLOT = UINT32_MAX;
+
+    uint32_t slot = NULL_SLOT;  ///< Номер слота
+    uint32_t generation = 0;    ///< Покоління слота на момент видачі
+
+    bool IsNull() const { return slot == NULL_SLOT; }
+
+    bool operator==(const Handle& other) const
+    {
+        return slot == other.slot && generation == other.generation;
+    }
+
+    bool operator!=(const Handle& other) const { return !(*this == other); }
+};
+
+/**
+ * @class SlotMap
+ * @brief Таблиця слотів для щільного вектора записів
+ *
+ * Записи зберігаються щільно у звичайному std::vector (видалення переносить
+ * на звільнену позицію останній запис), а таблиця слотів зв'язує кожен дескриптор з поточною
+ * позицією запису. Вставка, видалення та перестановка записів оновлюють
+ * позиції, тож дескриптор розіменовується за O(1) і залишається дійсним,
+ * доки запис не видалено.
+ *
+ * @tparam T Тип запису
+ */
+template <typename T>
+class SlotMap {
+public:
+    static constexpr size_t NOT_FOUND = static_cast<size_t>(-1);
+
+private:
+    /**
+     * @struct Slot
+     * @brief Слот: позиція запису або наступний вільний слот
+     */
+    struct Slot {
+        uint32_t position;    ///< Позиція запису у векторі (або наступний вільний слот)
+        uint32_t generation;  ///< Поточне покоління
+        bool occupied;        ///< Чи зайнятий слот
+    };
+
+    std::vector<Slot> m_slots;              ///< Усі слоти
+    std::vector<uint32_t> m_positionToSlot; ///< Позиція запису -> номер слота
+    uint32_t m_freeHead = Handle<T>::NULL_SLOT; ///< Перший вільний слот
+
+    uint32_t AllocateSlot(uint32_t position)
+    {
+        uint32_t slot;
+        if (m_freeHead != Handle<T>::NULL_SLOT)
+        {
+            slot = m_freeHead;
+            m_freeHead = m_slots[slot].position;
+        }
+        else
+        {
+            slot = static_cast<uint32_t>(m_slots.size());
+            m_slots.push_back(Slot{0, 0, false});
+        }
+        m_slots[slot].position = position;
+        m_slots[slot].occupied = true;
+        return slot;
+    }
+
+    void ReleaseSlot(uint32_t slot)
+    {
+        m_slots[slot].generation++;
+        m_slots[slot].occupied = false;
+        m_slots[slot].position = m_freeHead;
+        m_freeHead = slot;
+    }
+
+public:
+    /**
+     * @brief Реєструє запис, доданий у кінець вектора
+     * @return Дескриптор нового запису
+     */
+    Handle<T> Insert()
+    {
+        uint32_t slot = AllocateSlot(static_cast<uint32_t>(m_positionToSlot.size()));
+        m_positionToSlot.push_back(slot);
+        return Handle<T>{slot, m_slots[slot].generation};
+    }
+
+    /**
+     * @brief Видаляє запис на позиції, переносячи на неї останній запис
+     * @details Відповідає видаленню з вектора записів обміном з останнім
+     * елементом, тож оновлюється лише один слот - O(1).
+     * @param position Позиція видаленого запису
+     */
+    void Erase(size_t position)
+    {
+        ReleaseSlot(m_positionToSlot[position]);
+        uint32_t moved = m_positionToSlot.back();
+        m_positionToSlot.pop_back();
+        if (position < m_positionToSlot.size())
+        {
+            m_positionToSlot[position] = moved;
+            m_slots[moved].position = static_cast<uint32_t>(position);
+        }
+    }
+
+    /**
+     * @brief Застосовує перестановку записів (наприклад, після сортування)
+     * @param order order[i] - попередня позиція запису, що тепер стоїть на позиції i
+     */
+    void Permute(const std::vector<size_t>& order)
+    {
+        std::vector<uint32_t> positionToSlot(order.size());
+        for (size_t i = 0; i < order.size(); i++)
+        {
+            positionToSlot[i] = m_positionToSlot[order[i]];
+            m_slots[positionToSlot[i]].position = static_cast<uint32_t>(i);
+        }
+        m_positionToSlot = std::move(positionToSlot);
+    }
+
+    /**
+     * @brief Скидає таблицю для повністю замінених записів
+     * @details Усі видані раніше дескриптори стають недійсними.
+     * @param count Кількість записів
+     */
+    void Reset(size_t count)
+    {
+        for (uint32_t position = 0; position < m_positionToSlot.size(); position++)
+        {
+            ReleaseSlot(m_positionToSlot[position]);
+        }
+        m_positionToSlot.clear();
+        m_positionToSlot.reserve(count);
+        for (size_t i = 0; i < count; i++)
+        {
+            Insert();
+        }
+    }
+
+    /**
+     * @brief Повертає поточну позицію запису
+     * @param handle Дескриптор
+     * @return Позиція або NOT_FOUND, якщо дескриптор недійсний
+     */
+    size_t Resolve(Handle<T> handle) const
+    {
+        if (handle.slot >= m_slots.size())
+        {
+            return NOT_FOUND;
+        }
+        const Slot& slot = m_slots[handle.slot];
+        if (!slot.occupied || slot.generation != handle.generation)
+        {
+            return NOT_FOUND;
+        }
+        return slot.position;
+    }
+
+    /**
+     * @brief Повертає дескриптор запису на позиції
+     * @param position Позиція запису
+     * @return Дескриптор або порожній дескриптор, якщо позиції немає
+     */
+    Handle<T> HandleAt(size_t position) const
+    {
+        if (position >= m_positionToSlot.size())
+        {
+            return Handle<T>();
+        }
+        uint32_t slot = m_positionToSlot[position];
+        return Handle<T>{slot, m_slots[slot].generation};
+    }
+
+    /**
+     * @brief Повертає кількість зареєстрованих записів
+     */
+    size_t Size() const
+    {
+        return m_positionToSlot.size();
+    }
+};
+
+} // namespace University
+
+#endif // SLOTMAP_H
@@ -0,0 +1,275 @@
+#include "Snapshot.h"
+
+#include <array>
+#include <filesystem>
+#include <fstream>
+#include <iostream>
+#include <system_error>
+
+#include "FileUtils.h"
+
+using namespace std;
+
+namespace University {
+
+namespace {
+
+const char SNAPSHOT_MAGIC[8] = {'U', 'N', 'I', 'V', 'S', 'N', 'A', 'P'};
+
+// Сигнатура, версія, тип, розмір CSV, час зміни CSV, кількість записів
+const size_t HEADER_SIZE = sizeof(SNAPSHOT_MAGIC) + 4 + 4 + 8 + 8 + 4;
+const size_t CHECKSUM_SIZE = 4;
+
+array<uint32_t, 256> BuildCrcTable()
+{
+    array<uint32_t, 256> table{};
+    for (uint32_t i = 0; i < 256; i++)
+    {
+        uint32_t crc = i;
+        for (int bit = 0; bit < 8; bit++)
+        {
+            crc = (crc & 1) ? (crc >> 1) ^ 0xEDB88320u : crc >> 1;
+        }
+        table[i] = crc;
+    }
+    return table;
+}
+
+/**
+ * @brief Отримує відбиток CSV-файлу (розмір та час зміни)
+ */
+bool GetCsvFingerprint(const string& csvFilename, uint64_t& size, uint64_t& modified)
+{
+    error_code error;
+    auto fileSize = filesystem::file_size(csvFilename, error);
+    if (error)
+    {
+        return false;
+    }
+    auto writeTime = filesystem::last_write_time(csvFilename, error);
+    if (error)
+    {
+        return false;
+    }
+    size = static_cast<uint64_t>(fileSize);
+    modified = static_cast<uint64_t>(writeTime.time_since_epoch().count());
+    return true;
+}
+
+} // namespace
+
+// === SnapshotWriter ===
+
+void SnapshotWriter::WriteUInt32(uint32_t value)
+{
+    for (int shift = 0; shift < 32; shift += 8)
+    {
+        m_buffer.push_back(static_cast<char>((value >> shift) & 0xFF));
+    }
+}
+
+void SnapshotWriter::WriteInt32(int32_t value)
+{
+    WriteUInt32(static_cast<uint32_t>(value));
+}
+
+void SnapshotWriter::WriteUInt64(uint64_t value)
+{
+    for (int shift = 0; shift < 64; shift += 8)
+    {
+        m_buffer.push_back(static_cast<char>((value >> shift) & 0xFF));
+    }
+}
+
+void SnapshotWriter::WriteString(string_view value)
+{
+    WriteUInt32(static_cast<uint32_t>(value.size()));
+    m_buffer.append(value);
+}
+
+void SnapshotWriter::Reserve(size_t size)
+{
+    m_buffer.reserve(size);
+}
+
+const string& SnapshotWriter::GetBuffer() const
+{
+    return m_buffer;
+}
+
+// === SnapshotReader ===
+
+SnapshotReader::SnapshotReader(const string& buffer, size_t position)
+    : m_buffer(buffer), m_position(position), m_failed(false)
+{
+}
+
+uint32_t SnapshotReader::ReadUInt32()
+{
+    if (m_failed || m_buffer.size() - m_position < 4)
+    {
+        m_failed = true;
+        return 0;
+    }
+    uint32_t value = 0;
+    for (int i = 0; i < 4; i++)
+    {
+        value |= static_cast<uint32_t>(static_cast<unsigned char>(m_buffer[m_position + i])) << (8 * i);
+    }
+    m_position += 4;
+    return value;
+}
+
+int32_t SnapshotReader::ReadInt32()
+{
+    return static_cast<int32_t>(ReadUInt32());
+}
+
+uint64_t SnapshotReader::ReadUInt64()
+{
+    if (m_failed || m_buffer.size() - m_position < 8)
+    {
+        m_failed = true;
+        return 0;
+    }
+    uint64_t value = 0;
+    for (int i = 0; i < 8; i++)
+    {
+        value |= static_cast<uint64_t>(static_cast<unsigned char>(m_buffer[m_position + i])) << (8 * i);
+    }
+    m_position += 8;
+    return value;
+}
+
+string SnapshotReader::ReadString()
+{
+    uint32_t length = ReadUInt32();
+    if (m_failed || m_buffer.size() - m_position < length)
+    {
+        m_failed = true;
+        return "";
+    }
+    string value(m_buffer, m_position, length);
+    m_position += length;
+    return value;
+}
+
+bool SnapshotReader::HasFailed() const
+{
+    return m_failed;
+}
+
+// === Snapshot ===
+
+string Snapshot::GetFilename(const string& csvFilename)
+{
+    const string extension = ".csv";
+    if (csvFilename.size() > extension.size() &&
+        csvFilename.compare(csvFilename.size() - extension.size(), extension.size(), extension) == 0)
+    {
+        return csvFilename.substr(0, csvFilename.size() - extension.size()) + ".snap";
+    }
+    return csvFilename + ".snap";
+}
+
+bool Snapshot::Save(const string& csvFilename, SnapshotKind kind,
+                    uint32_t recordCount, const string& body)
+{
+    uint64_t csvSize, csvModified;
+    if (!GetCsvFingerprint(csvFilename, csvSize, csvModified))
+    {
+        return false;
+    }
+
+    string content(SNAPSHOT_MAGIC, sizeof(SNAPSHOT_MAGIC));
+    SnapshotWriter fields;
+    fields.WriteUInt32(FORMAT_VERSION);
+    fields.WriteUInt32(static_cast<uint32_t>(kind));
+    fields.WriteUInt64(csvSize);
+    fields.WriteUInt64(csvModified);
+    fields.WriteUInt32(recordCount);
+
+    content.reserve(HEADER_SIZE + body.size() + CHECKSUM_SIZE);
+    content += fields.GetBuffer();
+    content += body;
+
+    SnapshotWriter checksum;
+    checksum.WriteUInt32(Crc32(content.data(), content.size()));
+    content += checksum.GetBuffer();
+
+    return FileUtils::WriteAtomically(GetFilename(csvFilename), content);
+}
+
+bool Snapshot::Load(const string& csvFilename, SnapshotKind kind,
+                    string& content, size_t& bodyOffset, uint32_t& recordCount)
+{
+    ifstream file(GetFilename(csvFilename), ios::binary | ios::ate);
+    if (!file.is_open())
+    {
+        return false;
+    }
+
+    // Одне послідовне читання всього файлу
+    streamsize size = file.tellg();
+    if (size < static_cast<streamsize>(HEADER_SIZE + CHECKSUM_SIZE))
+    {
+        return false;
+    }
+    content.resize(static_cast<size_t>(size));
+    file.seekg(0);
+    if (!file.read(content.data(), size))
+    {
+        return false;
+    }
+
+    if (content.compare(0, sizeof(SNAPSHOT_MAGIC), SNAPSHOT_MAGIC, sizeof(SNAPSHOT_MAGIC)) != 0)
+    {
+        return false;
+    }
+
+    size_t payloadSize = content.size() - CHECKSUM_SIZE;
+    SnapshotReader trailer(content, payloadSize);
+    if (trailer.ReadUInt32() != Crc32(content.data(), payloadSize))
+    {
+        cerr << "Знімок пошкоджено, використовується CSV: " + GetFilename(csvFilename) + "\n";
+        return false;
+    }
+
+    SnapshotReader header(content, sizeof(SNAPSHOT_MAGIC));
+    uint32_t version = header.ReadUInt32();
+    uint32_t storedKind = header.ReadUInt32();
+    uint64_t storedSize = header.ReadUInt64();
+    uint64_t storedModified = header.ReadUInt64();
+    recordCount = header.ReadUInt32();
+
+    if (header.HasFailed() || version != FORMAT_VERSION ||
+        storedKind != static_cast<uint32_t>(kind))
+    {
+        return false;
+    }
+
+    // CSV змінено поза програмою - знімок застарів
+    uint64_t csvSize, csvModified;
+    if (!GetCsvFingerprint(csvFilename, csvSize, csvModified) ||
+        csvSize != storedSize || csvModified != storedModified)
+    {
+        return false;
+    }
+
+    content.resize(payloadSize);
+    bodyOffset = HEADER_SIZE;
+    return true;
+}
+
+uint32_t Snapshot::Crc32(const char* data, size_t size)
+{
+    static const array<uint32_t, 256> table = BuildCrcTable();
+    uint32_t crc = 0xFFFFFFFFu;
+    for (size_t i = 0; i < size; i++)
+    {
+        crc = table[(crc ^ static_cast<unsigned char>(data[i])) & 0xFF] ^ (crc >> 8);
+    }
+    return crc ^ 0xFFFFFFFFu;
+}
+
+} // namespace University
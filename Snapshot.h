@@ -0,0 +1,133 @@
+/**
+ * @file Snapshot.h
+ * @brief Заголовний файл для бінарних знімків колекцій бази даних
+ */
+
+#ifndef SNAPSHOT_H
+#define SNAPSHOT_H
+
+#include <cstdint>
+#include <string>
+#include <string_view>
+
+namespace University {
+
+/**
+ * @enum SnapshotKind
+ * @brief Тип колекції, збереженої у знімку
+ */
+enum class SnapshotKind : uint32_t {
+    Students = 1,  ///< Студенти
+    Teachers = 2,  ///< Викладачі
+    Subjects = 3   ///< Предмети
+};
+
+/**
+ * @class SnapshotWriter
+ * @brief Формує тіло знімка: числа фіксованої ширини (little-endian) та рядки з префіксом довжини
+ */
+class SnapshotWriter {
+private:
+    std::string m_buffer;  ///< Сформовані байти
+
+public:
+    void WriteUInt32(uint32_t value);
+    void WriteInt32(int32_t value);
+    void WriteUInt64(uint64_t value);
+    void WriteString(std::string_view value);
+
+    /**
+     * @brief Резервує місце під очікуваний обсяг даних
+     * @param size Кількість байтів
+     */
+    void Reserve(size_t size);
+
+    const std::string& GetBuffer() const;
+};
+
+/**
+ * @class SnapshotReader
+ * @brief Послідовно читає тіло знімка
+ *
+ * Вихід за межі буфера не кидає виняток, а встановлює прапор помилки,
+ * який перевіряється після читання всіх записів.
+ */
+class SnapshotReader {
+private:
+    const std::string& m_buffer;  ///< Буфер з даними знімка
+    size_t m_position;            ///< Поточна позиція читання
+    bool m_failed;                ///< Ознака виходу за межі буфера
+
+public:
+    /**
+     * @brief Конструктор з параметрами
+     * @param buffer Буфер з даними
+     * @param position Початкова позиція
+     */
+    SnapshotReader(const std::string& buffer, size_t position);
+
+    uint32_t ReadUInt32();
+    int32_t ReadInt32();
+    uint64_t ReadUInt64();
+    std::string ReadString();
+
+    bool HasFailed() const;
+};
+
+/**
+ * @class Snapshot
+ * @brief Версіонований бінарний знімок однієї колекції
+ *
+ * Формат файлу: сигнатура, версія, тип колекції, розмір і час зміни
+ * CSV-файлу, з якого зроблено знімок, кількість записів, тіло та CRC32.
+ * Тіло починається з таблиці символів записів знімка (SymbolSubset::WriteTo),
+ * а категоріальні поля записів зберігаються номерами з цієї таблиці.
+ * Знімок використовується лише якщо CSV-файл не змінювався після його
+ * створення, тож CSV залишається основним форматом обміну даними.
+ */
+class Snapshot {
+public:
+    static const uint32_t FORMAT_VERSION = 2;  ///< Поточна версія формату (2 - таблиця символів у тілі)
+
+    /**
+     * @brief Повертає шлях до знімка для CSV-файлу
+     * @param csvFilename Шлях до CSV-файлу
+     * @return Шлях до файлу знімка (students.csv -> students.snap)
+     */
+    static std::string GetFilename(const std::string& csvFilename);
+
+    /**
+     * @brief Атомарно зберігає знімок колекції
+     * @param csvFilename CSV-файл, якому відповідає знімок (вже записаний)
+     * @param kind Тип колекції
+     * @param recordCount Кількість записів
+     * @param body Тіло знімка
+     * @return true якщо успішно, false в іншому випадку
+     */
+    static bool Save(const std::string& csvFilename, SnapshotKind kind,
+                     uint32_t recordCount, const std::string& body);
+
+    /**
+     * @brief Завантажує знімок, якщо він актуальний та неушкоджений
+     * @param csvFilename CSV-файл, якому відповідає знімок
+     * @param kind Очікуваний тип колекції
+     * @param content Весь вміст файлу знімка
+     * @param bodyOffset Позиція початку тіла у вмісті
+     * @param recordCount Кількість записів
+     * @return true якщо знімок можна використати, false в іншому випадку
+     */
+    static bool Load(const std::string& csvFilename, SnapshotKind kind,
+                     std::string& content, size_t& bodyOffset, uint32_t& recordCount);
+
+    /**
+     * @brief Обчислює контрольну суму CRC32
+     * @param data Дані
+     * @param size Розмір даних
+     * @return Контрольна сума
+     */
+    static uint32_t Crc32(const char* data, size_t size);
+};
+
+} // namespace University
+
+#endif // SNAPSHOT_H
@@ -0,0 +1,91 @@
+#include "StartupLoader.h"
+
+#include <future>
+
+#include "AssignmentManager.h"
+#include "UserManager.h"
+
+using namespace std;
+
+namespace University {
+
+namespace {
+
+template <typename Load>
+SourceLoadResult MeasureLoad(const string& source, Load load)
+{
+    auto start = chrono::steady_clock::now();
+    bool success = load();
+    return SourceLoadResult{source, success,
+        chrono::duration_cast<chrono::milliseconds>(chrono::steady_clock::now() - start)};
+}
+
+} // namespace
+
+StartupLoader::StartupLoader(DatabaseManager* dbManager, UserManager* userManager,
+                             AssignmentManager* assignmentManager)
+    : m_dbManager(dbManager), m_userManager(userManager),
+      m_assignmentManager(assignmentManager), m_totalTime(0)
+{
+}
+
+bool StartupLoader::LoadAll()
+{
+    m_results.clear();
+    auto start = chrono::steady_clock::now();
+
+    future<SourceLoadResult> users;
+    future<SourceLoadResult> assignments;
+
+    if (m_userManager)
+    {
+        users = async(launch::async, [this]()
+        {
+            return MeasureLoad("Користувачі", [this]()
+            {
+                string result = m_userManager->Open();
+                return result.rfind("ПОМИЛКА", 0) != 0;
+            });
+        });
+    }
+
+    if (m_assignmentManager)
+    {
+        assignments = async(launch::async, [this]()
+        {
+            return MeasureLoad("Призначення", [this]() { return m_assignmentManager->open(); });
+        });
+    }
+
+    // Три колекції бази даних завантажуються паралельно всередині Open
+    bool success = true;
+    if (m_dbManager)
+    {
+        success = m_dbManager->Open(&m_results);
+    }
+
+    for (auto* pending : {&users, &assignments})
+    {
+        if (pending->valid())
+        {
+            SourceLoadResult result = pending->get();
+            success = success && result.success;
+            m_results.push_back(result);
+        }
+    }
+
+    m_totalTime = chrono::duration_cast<chrono::milliseconds>(chrono::steady_clock::now() - start);
+    return success;
+}
+
+const vector<SourceLoadResult>& StartupLoader::GetResults() const
+{
+    return m_results;
+}
+
+chrono::milliseconds StartupLoader::GetTotalTime() const
+{
+    return m_totalTime;
+}
+
+} // namespace University
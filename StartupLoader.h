@@ -0,0 +1,64 @@
+/**
+ * @file StartupLoader.h
+ * @brief Заголовний файл для одночасного завантаження всіх джерел даних під час запуску
+ */
+
+#ifndef STARTUPLOADER_H
+#define STARTUPLOADER_H
+
+#include <chrono>
+#include <vector>
+
+#include "DatabaseManager.h"
+
+namespace University {
+
+class UserManager;
+class AssignmentManager;
+
+/**
+ * @class StartupLoader
+ * @brief Завантажує студентів, викладачів, предметів, користувачів і призначення одночасно
+ *
+ * Кожне джерело відкривається (Open) у власному потоці, а LoadAll() повертає
+ * керування лише після завершення всіх, тож час запуску визначається найбільшим
+ * файлом, а не сумою всіх. Уже завантажені джерела повторно не читаються.
+ */
+class StartupLoader {
+private:
+    DatabaseManager* m_dbManager;                  ///< Менеджер бази даних
+    UserManager* m_userManager;                    ///< Менеджер користувачів
+    AssignmentManager* m_assignmentManager;        ///< Менеджер призначень
+    std::vector<SourceLoadResult> m_results;       ///< Результати завантаження джерел
+    std::chrono::milliseconds m_totalTime;         ///< Загальна тривалість завантаження
+
+public:
+    /**
+     * @brief Конструктор з параметрами
+     * @param dbManager Менеджер бази даних (може бути nullptr)
+     * @param userManager Менеджер користувачів (може бути nullptr)
+     * @param assignmentManager Менеджер призначень (може бути nullptr)
+     */
+    StartupLoader(DatabaseManager* dbManager, UserManager* userManager,
+                  AssignmentManager* assignmentManager);
+
+    /**
+     * @brief Завантажує всі джерела та чекає на завершення
+     * @return true якщо всі джерела завантажено успішно, false в іншому випадку
+     */
+    bool LoadAll();
+
+    /**
+     * @brief Повертає результати завантаження кожного джерела
+     */
+    const std::vector<SourceLoadResult>& GetResults() const;
+
+    /**
+     * @brief Повертає загальну тривалість останнього завантаження
+     */
+    std::chrono::milliseconds GetTotalTime() const;
+};
+
+} // namespace University
+
+#endif // STARTUPLOADER_H
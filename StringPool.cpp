@@ -0,0 +1,186 @@
+#include "StringPool.h"
+
+#include <cstring>
+
+#include "TextUtils.h"
+
+using namespace std;
+
+namespace University {
+
+StringPool::StringPool()
+    : m_current(nullptr), m_blockUsed(0), m_blockBytes(0)
+{
+}
+
+StringPool::StringPool(const StringPool& other)
+    : StringPool()
+{
+    *this = other;
+}
+
+StringPool::StringPool(StringPool&& other) noexcept
+    : m_blocks(std::move(other.m_blocks)),
+      m_current(other.m_current),
+      m_blockUsed(other.m_blockUsed),
+      m_blockBytes(other.m_blockBytes),
+      m_strings(std::move(other.m_strings)),
+      m_interned(std::move(other.m_interned)),
+      m_folded(std::move(other.m_folded))
+{
+    other.Clear();
+}
+
+StringPool& StringPool::operator=(const StringPool& other)
+{
+    if (this != &other)
+    {
+        Clear();
+        m_strings.reserve(other.m_strings.size());
+        for (size_t i = 0; i < other.m_strings.size(); i++)
+        {
+            string_view text = Store(other.m_strings[i]);
+            m_strings.push_back(text);
+            auto interned = other.m_interned.find(text);
+            if (interned != other.m_interned.end() && interned->second == i)
+            {
+                m_interned.emplace(text, static_cast<uint32_t>(i));
+            }
+        }
+        m_folded = other.m_folded;
+    }
+    return *this;
+}
+
+StringPool& StringPool::operator=(StringPool&& other) noexcept
+{
+    if (this != &other)
+    {
+        m_blocks = std::move(other.m_blocks);
+        m_current = other.m_current;
+        m_blockUsed = other.m_blockUsed;
+        m_blockBytes = other.m_blockBytes;
+        m_strings = std::move(other.m_strings);
+        m_interned = std::move(other.m_interned);
+        m_folded = std::move(other.m_folded);
+        other.Clear();
+    }
+    return *this;
+}
+
+string_view StringPool::Store(string_view text)
+{
+    if (text.empty())
+    {
+        return string_view();
+    }
+    // Довгий рядок отримує власний блок, щоб не марнувати залишок поточного
+    if (text.size() > BLOCK_SIZE / 4)
+    {
+        auto block = make_unique<char[]>(text.size());
+        memcpy(block.get(), text.data(), text.size());
+        string_view stored(block.get(), text.size());
+        m_blocks.push_back(std::move(block));
+        m_blockBytes += text.size();
+        return stored;
+    }
+    if (!m_current || m_blockUsed + text.size() > BLOCK_SIZE)
+    {
+        m_blocks.push_back(make_unique<char[]>(BLOCK_SIZE));
+        m_current = m_blocks.back().get();
+        m_blockUsed = 0;
+        m_blockBytes += BLOCK_SIZE;
+    }
+    char* target = m_current + m_blockUsed;
+    memcpy(target, text.data(), text.size());
+    m_blockUsed += text.size();
+    return string_view(target, text.size());
+}
+
+uint32_t StringPool::Add(string_view text)
+{
+    m_strings.push_back(Store(text));
+    return static_cast<uint32_t>(m_strings.size() - 1);
+}
+
+uint32_t StringPool::Intern(string_view text)
+{
+    auto found = m_interned.find(text);
+    if (found != m_interned.end())
+    {
+        return found->second;
+    }
+    uint32_t symbol = Add(text);
+    m_interned.emplace(m_strings[symbol], symbol);
+    return symbol;
+}
+
+void StringPool::StoreFolded(uint32_t symbol)
+{
+    if (symbol < m_folded.size() && m_folded[symbol] != NO_FOLDED)
+    {
+        return;
+    }
+    string_view text = m_strings[symbol];
+    string folded = TextUtils::FoldCase(text);
+    uint32_t foldedSymbol = folded == text ? symbol : Intern(folded);
+    if (m_folded.size() <= symbol)
+    {
+        m_folded.resize(m_strings.size(), NO_FOLDED);
+    }
+    m_folded[symbol] = foldedSymbol;
+}
+
+uint32_t StringPool::AddFolded(string_view text)
+{
+    uint32_t symbol = Add(text);
+    StoreFolded(symbol);
+    return symbol;
+}
+
+uint32_t StringPool::InternFolded(string_view text)
+{
+    uint32_t symbol = Intern(text);
+    StoreFolded(symbol);
+    return symbol;
+}
+
+string_view StringPool::Get(uint32_t symbol) const
+{
+    return m_strings[symbol];
+}
+
+string_view StringPool::GetFolded(uint32_t symbol) const
+{
+    return m_strings[m_folded[symbol]];
+}
+
+size_t StringPool::GetCount() const
+{
+    return m_strings.size();
+}
+
+size_t StringPool::GetMemoryUsage() const
+{
+    // Вузол хеш-таблиці: ключ, номер і два вказівники службових даних
+    const size_t internedNodeSize = sizeof(string_view) + sizeof(uint32_t) + 2 * sizeof(void*);
+    return m_blockBytes +
+           m_blocks.capacity() * sizeof(unique_ptr<char[]>) +
+           m_strings.capacity() * sizeof(string_view) +
+           m_interned.bucket_count() * sizeof(void*) +
+           m_interned.size() * internedNodeSize +
+           m_folded.capacity() * sizeof(uint32_t);
+}
+
+void StringPool::Clear()
+{
+    m_blocks.clear();
+    m_current = nullptr;
+    m_blockUsed = 0;
+    m_blockBytes = 0;
+    m_strings.clear();
+    m_interned.clear();
+    m_folded.clear();
+}
+
+} // namespace University
@@ -0,0 +1,133 @@
+/**
+ * @file StringPool.h
+ * @brief Заголовний файл для пулу рядків з компактними номерами
+ */
+
+#ifndef STRINGPOOL_H
+#define STRINGPOOL_H
+
+#include <cstdint>
+#include <memory>
+#include <string_view>
+#include <unordered_map>
+#include <vector>
+
+namespace University {
+
+/**
+ * @class StringPool
+ * @brief Сховище рядків, що видає замість рядка 32-бітний номер
+ *
+ * Байти рядків складаються підряд у великі блоки, тож рядок коштує
+ * лише свою довжину та 16 байтів опису замість окремого виділення
+ * пам'яті з заголовком std::string. Блоки не переміщуються, тому
+ * повернуті std::string_view дійсні, доки пул не очищено.
+ *
+ * Intern() повертає той самий номер для однакових рядків (імена,
+ * програми, ID предметів), Add() зберігає рядок без пошуку повтору
+ * (унікальні значення на кшталт email, де таблиця повторів лише
+ * додала б пам'яті).
+ *
+ * InternFolded() і AddFolded() додатково зберігають варіант рядка в нижньому
+ * регістрі для пошуку без урахування регістру. Варіант інтернується, а для
+ * рядка без великих літер ним є сам рядок, тож повторювані імена та email
+ * у нижньому регістрі не займають додаткових байтів.
+ */
+class StringPool {
+private:
+    static const size_t BLOCK_SIZE = 64 * 1024;  ///< Розмір блоку байтів
+
+    std::vector<std::unique_ptr<char[]>> m_blocks;          ///< Блоки з байтами рядків
+    char* m_current;                                        ///< Блок, що заповнюється (nullptr - ще немає)
+    size_t m_blockUsed;                                     ///< Зайнято байтів у поточному блоці
+    size_t m_blockBytes;                                    ///< Сумарний розмір усіх блоків
+    std::vector<std::string_view> m_strings;                ///< Номер -> рядок
+    std::unordered_map<std::string_view, uint32_t> m_interned; ///< Рядок -> номер (лише для Intern)
+    std::vector<uint32_t> m_folded;                         ///< Номер -> номер варіанта в нижньому регістрі
+
+    static constexpr uint32_t NO_FOLDED = UINT32_MAX;  ///< Варіант у нижньому регістрі не зберігався
+
+    std::string_view Store(std::string_view text);
+    void StoreFolded(uint32_t symbol);
+
+public:
+    /**
+     * @brief Конструктор за замовчуванням
+     */
+    StringPool();
+
+    /**
+     * @brief Конструктор копіювання
+     * @details Рядки копіюються в нові блоки зі збереженням номерів
+     * @param other Об'єкт для копіювання
+     */
+    StringPool(const StringPool& other);
+
+    /**
+     * @brief Конструктор переміщення
+     * @param other Об'єкт для переміщення
+     */
+    StringPool(StringPool&& other) noexcept;
+
+    StringPool& operator=(const StringPool& other);
+    StringPool& operator=(StringPool&& other) noexcept;
+
+    /**
+     * @brief Зберігає рядок без пошуку повтору
+     * @param text Рядок
+     * @return Номер рядка
+     */
+    uint32_t Add(std::string_view text);
+
+    /**
+     * @brief Повертає номер рядка, зберігаючи його лише за першої появи
+     * @param text Рядок
+     * @return Номер рядка
+     */
+    uint32_t Intern(std::string_view text);
+
+    /**
+     * @brief Зберігає рядок як Add() разом з його варіантом у нижньому регістрі
+     * @param text Рядок
+     * @return Номер рядка
+     */
+    uint32_t AddFolded(std::string_view text);
+
+    /**
+     * @brief Інтернує рядок як Intern() разом з його варіантом у нижньому регістрі
+     * @param text Рядок
+     * @return Номер рядка
+     */
+    uint32_t InternFolded(std::string_view text);
+
+    /**
+     * @brief Повертає рядок за номером
+     * @param symbol Номер, виданий Add() або Intern()
+     */
+    std::string_view Get(uint32_t symbol) const;
+
+    /**
+     * @brief Повертає рядок за номером у нижньому регістрі (TextUtils::FoldCase)
+     * @param symbol Номер, виданий AddFolded() або InternFolded()
+     */
+    std::string_view GetFolded(uint32_t symbol) const;
+
+    /**
+     * @brief Повертає кількість збережених рядків
+     */
+    size_t GetCount() const;
+
+    /**
+     * @brief Оцінює пам'ять, зайняту пулом, у байтах
+     */
+    size_t GetMemoryUsage() const;
+
+    /**
+     * @brief Видаляє всі рядки (номери та видані string_view стають недійсними)
+     */
+    void Clear();
+};
+
+} // namespace University
+
+#endif // STRINGPOOL_H
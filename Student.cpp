@@ -1,46 +1,14 @@
 #include "Student.h"
+#include "LifecycleTrace.h"
 #include <iostream>
 #include <algorithm>
 #include <stdexcept>
 #include <cctype>
-#ifdef _WIN32
-    #include <windows.h>
-#endif
 
 using namespace std;
 
 namespace University {
 
-bool Student::ukrainianSupportInitialized = false;
-
-void Student::initializeUkrainianSupport()
-{
-    if (ukrainianSupportInitialized)
-    {
-        return;
-    }
-#ifdef _WIN32
-    SetConsoleOutputCP(CP_UTF8);
-    SetConsoleCP(CP_UTF8);
-#endif
-    try
-    {
-        setlocale(LC_ALL, "uk_UA.UTF-8");
-    }
-    catch (...)
-    {
-        try
-        {
-            setlocale(LC_ALL, "C.UTF-8");
-        }
-        catch (...)
-        {
-            setlocale(LC_ALL, "");
-        }
-    }
-    ukrainianSupportInitialized = true;
-}
-
 bool Student::validateStudentID(const string& id) const
 {
     if (id.empty())
@@ -53,51 +21,66 @@ bool Student::validateStudentID(const string& id) const
     });
 }
 
-Student::Student() : Person(), studentID(""), educationalProgram("")
+Student::Student() : Person(), studentID(""), educationalProgram()
 {
-    initializeUkrainianSupport();
+    TRACE_LIFECYCLE(Student, Construct);
 }
 
 Student::Student(const string& name, const string& lastName,
                  const string& email, const string& studentID,
                  const string& educationalProgram)
-    : Person(name, lastName, email), studentID(studentID), educationalProgram(educationalProgram)
+    : Person(name, lastName, email), studentID(studentID), educationalProgram(SymbolTable::Intern(educationalProgram))
 {
-    initializeUkrainianSupport();
     if (!validateStudentID(studentID))
     {
         throw invalid_argument("Некоректний ID студента: " + studentID);
     }
+    TRACE_LIFECYCLE(Student, Construct);
+}
+
+Student::Student(TrustedData trusted, const string& name, const string& lastName,
+                 const string& email, const string& studentID,
+                 const string& educationalProgram)
+    : Person(trusted, name, lastName, email), studentID(studentID), educationalProgram(SymbolTable::Intern(educationalProgram))
+{
+    TRACE_LIFECYCLE(Student, Construct);
 }
 
 Student::Student(const Student& other)
     : Person(other), studentID(other.studentID), educationalProgram(other.educationalProgram),
       enrolledSubjects(other.enrolledSubjects)
 {
+    TRACE_LIFECYCLE(Student, Copy);
 }
 
 Student::Student(Student&& other) noexcept
     : Person(move(other)), studentID(move(other.studentID)),
-      educationalProgram(move(other.educationalProgram)), enrolledSubjects(move(other.enrolledSubjects))
+      educationalProgram(other.educationalProgram), enrolledSubjects(move(other.enrolledSubjects))
 {
+    TRACE_LIFECYCLE(Student, Move);
 }
 
 Student::~Student()
 {
-    cout << "Студент знищений: " << studentID << " - " << getFullName() << endl;
+    TRACE_LIFECYCLE(Student, Destroy);
 }
 
-string Student::getStudentID() const
+const string& Student::getStudentID() const
 {
     return studentID;
 }
 
-string Student::getEducationalProgram() const
+const string& Student::getEducationalProgram() const
+{
+    return educationalProgram.GetText();
+}
+
+Symbol Student::getEducationalProgramSymbol() const
 {
     return educationalProgram;
 }
 
-vector<string> Student::getEnrolledSubjects() const
+const vector<string>& Student::getEnrolledSubjects() const
 {
     return enrolledSubjects;
 }
@@ -122,7 +105,7 @@ void Student::setEducationalProgram(const string& educationalProgram)
     {
         throw invalid_argument("Освітня програма не може бути порожньою");
     }
-    this->educationalProgram = educationalProgram;
+    this->educationalProgram = SymbolTable::Intern(educationalProgram);
 }
 
 void Student::enrollSubject(const string& subjectId)
@@ -177,7 +160,7 @@ void Student::changeEducationalProgram(const string& newEducationalProgram)
     {
         throw invalid_argument("Нова освітня програма не може бути порожньою");
     }
-    educationalProgram = newEducationalProgram;
+    educationalProgram = SymbolTable::Intern(newEducationalProgram);
     clearSubjects();
 }
 
@@ -189,18 +172,18 @@ void Student::print() const
     cout << "  ID: " << studentID << endl;
     cout << "  Ім'я: " << getFullName() << endl;
     cout << "  Email: " << getEmail() << endl;
-    cout << "  Освітня програма: " << educationalProgram << endl;
+    cout << "  Освітня програма: " << educationalProgram.GetText() << endl;
     cout << "  Кількість предметів: " << enrolledSubjects.size() << endl;
 }
 
 string Student::toString() const
 {
-    return "Студент[" + studentID + "] " + getFullName() + " - " + educationalProgram;
+    return "Студент[" + studentID + "] " + getFullName() + " - " + educationalProgram.GetText();
 }
 
 bool Student::isValid() const
 {
-    return Person::isValid() && !studentID.empty() && !educationalProgram.empty();
+    return Person::isValid() && !studentID.empty() && !educationalProgram.IsEmpty();
 }
 
 Student& Student::operator=(const Student& other)
@@ -211,6 +194,7 @@ Student& Student::operator=(const Student& other)
         studentID = other.studentID;
         educationalProgram = other.educationalProgram;
         enrolledSubjects = other.enrolledSubjects;
+        TRACE_LIFECYCLE(Student, Copy);
     }
     return *this;
 }
@@ -221,8 +205,9 @@ Student& Student::operator=(Student&& other) noexcept
     {
         Person::operator=(move(other));
         studentID = move(other.studentID);
-        educationalProgram = move(other.educationalProgram);
+        educationalProgram = other.educationalProgram;
         enrolledSubjects = move(other.enrolledSubjects);
+        TRACE_LIFECYCLE(Student, Move);
     }
     return *this;
 }
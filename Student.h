@@ -7,6 +7,7 @@
 #define STUDENT_H
 
 #include "Person.h"
+#include "SymbolTable.h"
 #include <vector>
 #include <string>
 
@@ -22,14 +23,8 @@ namespace University {
     class Student : public Person {
     private:
         std::string studentID;                          ///< Унікальний ідентифікатор студента
-        std::string educationalProgram;                 ///< Освітня програма студента
+        Symbol educationalProgram;                      ///< Освітня програма студента (символ)
         std::vector<std::string> enrolledSubjects;      ///< Список предметів, на які записаний студент
-        static bool ukrainianSupportInitialized;        ///< Прапор ініціалізації української мови
-
-        /**
-         * @brief Ініціалізує підтримку української мови
-         */
-        void initializeUkrainianSupport();
 
         /**
          * @brief Валідує ID студента
@@ -56,6 +51,18 @@ namespace University {
                 const std::string& email, const std::string& studentID,
                 const std::string& educationalProgram);
 
+        /**
+         * @brief Конструктор з вже перевіреними даними (без валідації)
+         * @param name Ім'я студента
+         * @param lastName Прізвище студента
+         * @param email Електронна пошта
+         * @param studentID Унікальний ідентифікатор
+         * @param educationalProgram Освітня програма
+         */
+        Student(TrustedData, const std::string& name, const std::string& lastName,
+                const std::string& email, const std::string& studentID,
+                const std::string& educationalProgram);
+
         /**
          * @brief Конструктор копіювання
          * @param other Об'єкт для копіювання
@@ -74,9 +81,10 @@ namespace University {
         ~Student();
 
         // Гетери
-        std::string getStudentID() const;
-        std::string getEducationalProgram() const;
-        std::vector<std::string> getEnrolledSubjects() const;
+        const std::string& getStudentID() const;
+        const std::string& getEducationalProgram() const;
+        Symbol getEducationalProgramSymbol() const;
+        const std::vector<std::string>& getEnrolledSubjects() const;
         int getEnrolledSubjectsCount() const;
 
         // Сетери
@@ -3,6 +3,9 @@
 #include <algorithm>
 #include <cctype>
 
+#include "LifecycleTrace.h"
+#include "TextUtils.h"
+
 using namespace std;
 
 namespace University {
@@ -12,14 +15,15 @@ namespace University {
 //-----------------------------------------------------------------------------
 Subject::Subject()
     : subjectId(""), subjectName(""), ectsCredits(0),
-      teacherId(""), semester(1)
+      teacherId(), semester(1)
 {
+    TRACE_LIFECYCLE(Subject, Construct);
 }
 
 Subject::Subject(const string& subjectId, const string& subjectName,
                  int ectsCredits, const string& teacherId, int semester)
     : subjectId(subjectId), subjectName(subjectName),
-      ectsCredits(ectsCredits), teacherId(teacherId), semester(semester)
+      ectsCredits(ectsCredits), teacherId(SymbolTable::Intern(teacherId)), semester(semester)
 {
     if (!validateSubjectID(subjectId))
     {
@@ -36,22 +40,45 @@ Subject::Subject(const string& subjectId, const string& subjectName,
     {
         throw invalid_argument("Некоректний семестр: " + to_string(semester));
     }
+    TRACE_LIFECYCLE(Subject, Construct);
+}
+
+Subject::Subject(TrustedData, const string& subjectId, const string& subjectName,
+                 int ectsCredits, const string& teacherId, int semester)
+    : subjectId(subjectId), subjectName(subjectName),
+      ectsCredits(ectsCredits), teacherId(SymbolTable::Intern(teacherId)), semester(semester)
+{
+    TRACE_LIFECYCLE(Subject, Construct);
+}
+
+Subject::Subject(const Subject& other)
+    : IPrint(other), subjectId(other.subjectId), subjectName(other.subjectName),
+      ectsCredits(other.ectsCredits), teacherId(other.teacherId), semester(other.semester)
+{
+    TRACE_LIFECYCLE(Subject, Copy);
+}
+
+Subject::Subject(Subject&& other) noexcept
+    : IPrint(other), subjectId(move(other.subjectId)), subjectName(move(other.subjectName)),
+      ectsCredits(other.ectsCredits), teacherId(other.teacherId), semester(other.semester)
+{
+    TRACE_LIFECYCLE(Subject, Move);
 }
 
 Subject::~Subject()
 {
-    cout << "Предмет знищений: " << subjectId << " - " << subjectName << endl;
+    TRACE_LIFECYCLE(Subject, Destroy);
 }
 
 //-----------------------------------------------------------------------------
 // Властивості
 //-----------------------------------------------------------------------------
-string Subject::getSubjectId() const
+const string& Subject::getSubjectId() const
 {
     return subjectId;
 }
 
-string Subject::getSubjectName() const
+const string& Subject::getSubjectName() const
 {
     return subjectName;
 }
@@ -61,7 +88,12 @@ int Subject::getEctsCredits() const
     return ectsCredits;
 }
 
-string Subject::getTeacherId() const
+const string& Subject::getTeacherId() const
+{
+    return teacherId.GetText();
+}
+
+Symbol Subject::getTeacherIdSymbol() const
 {
     return teacherId;
 }
@@ -101,7 +133,7 @@ void Subject::setEctsCredits(int credits)
 
 void Subject::setTeacherId(const string& teacherId)
 {
-    this->teacherId = teacherId;
+    this->teacherId = SymbolTable::Intern(teacherId);
 }
 
 void Subject::setSemester(int sem)
@@ -126,10 +158,10 @@ bool Subject::assignTeacher(const string& teacherId)
     if (hasAssignedTeacher())
     {
         throw invalid_argument("Предмет вже має призначеного викладача: " +
-                              this->teacherId);
+                              this->teacherId.GetText());
     }
 
-    this->teacherId = teacherId;
+    this->teacherId = SymbolTable::Intern(teacherId);
     return true;
 }
 
@@ -140,13 +172,13 @@ bool Subject::removeTeacher()
         throw invalid_argument("Предмет не має призначеного викладача");
     }
 
-    teacherId.clear();
+    teacherId = Symbol{};
     return true;
 }
 
 bool Subject::hasAssignedTeacher() const
 {
-    return !teacherId.empty();
+    return !teacherId.IsEmpty();
 }
 
 void Subject::updateCredits(int newCredits)
@@ -183,17 +215,9 @@ string Subject::getSubjectInfo() const
 
 bool Subject::matchesSearchCriteria(const string& criteria) const
 {
-    string lowerCriteria = criteria;
-    transform(lowerCriteria.begin(), lowerCriteria.end(),
-              lowerCriteria.begin(), ::tolower);
-
-    string lowerName = subjectName;
-    transform(lowerName.begin(), lowerName.end(),
-              lowerName.begin(), ::tolower);
-
-    string lowerId = subjectId;
-    transform(lowerId.begin(), lowerId.end(),
-              lowerId.begin(), ::tolower);
+    string lowerCriteria = TextUtils::FoldCase(criteria);
+    string lowerName = TextUtils::FoldCase(subjectName);
+    string lowerId = TextUtils::FoldCase(subjectId);
 
     return lowerName.find(lowerCriteria) != string::npos ||
            lowerId.find(lowerCriteria) != string::npos;
@@ -211,7 +235,7 @@ void Subject::print() const
     cout << "  Назва: " << subjectName << endl;
     cout << "  Кредити ECTS: " << ectsCredits << endl;
     cout << "  Семестр: " << semester << endl;
-    cout << "  Викладач: " << (hasAssignedTeacher() ? teacherId : "Не призначено") << endl;
+    cout << "  Викладач: " << (hasAssignedTeacher() ? teacherId.GetText() : "Не призначено") << endl;
 }
 
 string Subject::toString() const
@@ -223,6 +247,34 @@ string Subject::toString() const
 //-----------------------------------------------------------------------------
 // Оператори
 //-----------------------------------------------------------------------------
+Subject& Subject::operator=(const Subject& other)
+{
+    if (this != &other)
+    {
+        subjectId = other.subjectId;
+        subjectName = other.subjectName;
+        ectsCredits = other.ectsCredits;
+        teacherId = other.teacherId;
+        semester = other.semester;
+        TRACE_LIFECYCLE(Subject, Copy);
+    }
+    return *this;
+}
+
+Subject& Subject::operator=(Subject&& other) noexcept
+{
+    if (this != &other)
+    {
+        subjectId = move(other.subjectId);
+        subjectName = move(other.subjectName);
+        ectsCredits = other.ectsCredits;
+        teacherId = other.teacherId;
+        semester = other.semester;
+        TRACE_LIFECYCLE(Subject, Move);
+    }
+    return *this;
+}
+
 bool Subject::operator==(const Subject& other) const
 {
     return subjectId == other.subjectId;
@@ -1,6 +1,8 @@
 #pragma once
 
 #include "IPrint.h"
+#include "SymbolTable.h"
+#include "TrustedData.h"
 #include <string>
 #include <stdexcept>
 
@@ -23,7 +25,7 @@ private:
     std::string subjectId;      ///< Ідентифікатор предмету
     std::string subjectName;    ///< Назва предмету
     int ectsCredits;           ///< Кількість ECTS кредитів
-    std::string teacherId;     ///< Ідентифікатор викладача
+    Symbol teacherId;          ///< Ідентифікатор викладача (символ)
     int semester;              ///< Семестр викладання
 
 public:
@@ -45,6 +47,29 @@ public:
     Subject(const std::string& subjectId, const std::string& subjectName,
             int ectsCredits, const std::string& teacherId, int semester);
 
+    /**
+     * @brief Конструктор з вже перевіреними даними (без валідації)
+     * @param subjectId Ідентифікатор предмету
+     * @param subjectName Назва предмету
+     * @param ectsCredits Кількість ECTS кредитів
+     * @param teacherId Ідентифікатор викладача
+     * @param semester Семестр викладання
+     */
+    Subject(TrustedData, const std::string& subjectId, const std::string& subjectName,
+            int ectsCredits, const std::string& teacherId, int semester);
+
+    /**
+     * @brief Конструктор копіювання
+     * @param other Об'єкт для копіювання
+     */
+    Subject(const Subject& other);
+
+    /**
+     * @brief Конструктор переміщення
+     * @param other Об'єкт для переміщення
+     */
+    Subject(Subject&& other) noexcept;
+
     /**
      * @brief Деструктор
      */
@@ -56,13 +81,13 @@ public:
      * @brief Отримує ідентифікатор предмету
      * @return Ідентифікатор предмету
      */
-    std::string getSubjectId() const;
+    const std::string& getSubjectId() const;
 
     /**
      * @brief Отримує назву предмету
      * @return Назва предмету
      */
-    std::string getSubjectName() const;
+    const std::string& getSubjectName() const;
 
     /**
      * @brief Отримує кількість ECTS кредитів
@@ -74,7 +99,13 @@ public:
      * @brief Отримує ідентифікатор викладача
      * @return Ідентифікатор викладача
      */
-    std::string getTeacherId() const;
+    const std::string& getTeacherId() const;
+
+    /**
+     * @brief Отримує символ ідентифікатора викладача
+     * @return Символ (порожній, якщо викладача не призначено)
+     */
+    Symbol getTeacherIdSymbol() const;
 
     /**
      * @brief Отримує семестр викладання
@@ -184,6 +215,20 @@ public:
 
     // Оператори
 
+    /**
+     * @brief Оператор присвоєння копіюванням
+     * @param other Об'єкт для копіювання
+     * @return Посилання на поточний об'єкт
+     */
+    Subject& operator=(const Subject& other);
+
+    /**
+     * @brief Оператор присвоєння переміщенням
+     * @param other Об'єкт для переміщення
+     * @return Посилання на поточний об'єкт
+     */
+    Subject& operator=(Subject&& other) noexcept;
+
     /**
      * @brief Оператор порівняння
      * @param other Об'єкт для порівняння
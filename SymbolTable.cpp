@@ -0,0 +1,188 @@
+#include "SymbolTable.h"
+
+#include <atomic>
+#include <memory>
+#include <mutex>
+#include <shared_mutex>
+#include <stdexcept>
+#include <unordered_map>
+#include <vector>
+
+#include "Snapshot.h"
+
+using namespace std;
+
+namespace University {
+
+namespace {
+
+const size_t CHUNK_SIZE = 4096;  ///< Значень в одному блоці
+const size_t MAX_CHUNKS = 4096;  ///< Найбільша кількість блоків
+
+/**
+ * @struct Storage
+ * @brief Стан таблиці
+ *
+ * Значення лежать у блоках фіксованого розміру, що ніколи не переміщуються:
+ * GetText() читає блок без блокування, а mutex захищає лише додавання.
+ */
+struct Storage {
+    shared_mutex mutex;                               ///< Захищає ids та додавання
+    unordered_map<string_view, uint32_t> ids;         ///< Значення -> номер
+    atomic<string*> chunks[MAX_CHUNKS] = {};          ///< Блоки значень
+    vector<unique_ptr<string[]>> ownedChunks;         ///< Власники блоків
+    atomic<uint32_t> count{0};                        ///< Кількість значень
+
+    Storage()
+    {
+        Append("");
+    }
+
+    /**
+     * @brief Додає значення з наступним номером (виклик під унікальним блокуванням)
+     */
+    uint32_t Append(string_view text)
+    {
+        uint32_t id = count.load(memory_order_relaxed);
+        size_t chunk = id / CHUNK_SIZE;
+        if (chunk >= MAX_CHUNKS)
+        {
+            throw length_error("Таблицю символів переповнено");
+        }
+        if (id % CHUNK_SIZE == 0)
+        {
+            ownedChunks.push_back(make_unique<string[]>(CHUNK_SIZE));
+            chunks[chunk].store(ownedChunks.back().get(), memory_order_release);
+        }
+        string& value = chunks[chunk].load(memory_order_relaxed)[id % CHUNK_SIZE];
+        value.assign(text);
+        ids.emplace(value, id);
+        count.store(id + 1, memory_order_release);
+        return id;
+    }
+};
+
+/**
+ * @brief Повертає стан таблиці
+ * @details Об'єкт навмисно не знищується: символи можуть читатися
+ * деструкторами інших статичних об'єктів під час завершення програми.
+ */
+Storage& GetStorage()
+{
+    static Storage* storage = new Storage();
+    return *storage;
+}
+
+} // namespace
+
+const string& Symbol::GetText() const
+{
+    return SymbolTable::GetText(*this);
+}
+
+Symbol SymbolTable::Intern(string_view text)
+{
+    Storage& storage = GetStorage();
+    {
+        shared_lock<shared_mutex> lock(storage.mutex);
+        auto found = storage.ids.find(text);
+        if (found != storage.ids.end())
+        {
+            return Symbol{found->second};
+        }
+    }
+    unique_lock<shared_mutex> lock(storage.mutex);
+    auto found = storage.ids.find(text);
+    if (found != storage.ids.end())
+    {
+        return Symbol{found->second};
+    }
+    return Symbol{storage.Append(text)};
+}
+
+bool SymbolTable::Find(string_view text, Symbol& symbol)
+{
+    Storage& storage = GetStorage();
+    shared_lock<shared_mutex> lock(storage.mutex);
+    auto found = storage.ids.find(text);
+    if (found == storage.ids.end())
+    {
+        return false;
+    }
+    symbol = Symbol{found->second};
+    return true;
+}
+
+const string& SymbolTable::GetText(Symbol symbol)
+{
+    Storage& storage = GetStorage();
+    if (symbol.id >= storage.count.load(memory_order_acquire))
+    {
+        return storage.chunks[0].load(memory_order_acquire)[0];
+    }
+    return storage.chunks[symbol.id / CHUNK_SIZE].load(memory_order_acquire)[symbol.id % CHUNK_SIZE];
+}
+
+size_t SymbolTable::GetCount()
+{
+    return GetStorage().count.load(memory_order_acquire);
+}
+
+bool SymbolTable::ReadFrom(SnapshotReader& reader, vector<Symbol>& symbols)
+{
+    uint32_t count = reader.ReadUInt32();
+    if (reader.HasFailed() || count == 0 || count > CHUNK_SIZE * MAX_CHUNKS)
+    {
+        return false;
+    }
+    vector<string> values;
+    values.reserve(count);
+    values.emplace_back();
+    for (uint32_t id = 1; id < count && !reader.HasFailed(); id++)
+    {
+        values.push_back(reader.ReadString());
+    }
+    if (reader.HasFailed())
+    {
+        return false;
+    }
+
+    Storage& storage = GetStorage();
+    unique_lock<shared_mutex> lock(storage.mutex);
+    symbols.assign(count, Symbol{});
+    for (uint32_t id = 1; id < count; id++)
+    {
+        auto found = storage.ids.find(values[id]);
+        symbols[id] = Symbol{found != storage.ids.end() ? found->second : storage.Append(values[id])};
+    }
+    return true;
+}
+
+void SymbolSubset::Add(Symbol symbol)
+{
+    if (symbol.IsEmpty())
+    {
+        return;
+    }
+    if (m_dense.emplace(symbol.id, static_cast<uint32_t>(m_symbols.size() + 1)).second)
+    {
+        m_symbols.push_back(symbol);
+    }
+}
+
+uint32_t SymbolSubset::Encode(Symbol symbol) const
+{
+    auto found = m_dense.find(symbol.id);
+    return found != m_dense.end() ? found->second : 0;
+}
+
+void SymbolSubset::WriteTo(SnapshotWriter& writer) const
+{
+    writer.WriteUInt32(static_cast<uint32_t>(m_symbols.size() + 1));
+    for (Symbol symbol : m_symbols)
+    {
+        writer.WriteString(symbol.GetText());
+    }
+}
+
+} // namespace University
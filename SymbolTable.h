@@ -0,0 +1,134 @@
+/**
+ * @file SymbolTable.h
+ * @brief Заголовний файл для спільної таблиці символів категоріальних полів
+ */
+
+#ifndef SYMBOLTABLE_H
+#define SYMBOLTABLE_H
+
+#include <cstdint>
+#include <functional>
+#include <string>
+#include <string_view>
+#include <unordered_map>
+#include <vector>
+
+namespace University {
+
+class SnapshotWriter;
+class SnapshotReader;
+
+/**
+ * @struct Symbol
+ * @brief 4-байтний номер значення в SymbolTable
+ *
+ * Однакові значення мають однаковий номер, тож порівняння символів -
+ * порівняння чисел. Символ за замовчуванням означає порожній рядок.
+ */
+struct Symbol {
+    uint32_t id = 0;  ///< Номер значення в таблиці (0 - порожній рядок)
+
+    bool IsEmpty() const { return id == 0; }
+
+    /**
+     * @brief Повертає текст значення (посилання дійсне до завершення програми)
+     */
+    const std::string& GetText() const;
+
+    bool operator==(const Symbol& other) const { return id == other.id; }
+    bool operator!=(const Symbol& other) const { return id != other.id; }
+};
+
+/**
+ * @class SymbolTable
+ * @brief Спільна для процесу таблиця повторюваних значень (програми, кафедри, ID викладачів)
+ *
+ * Кожне різне значення зберігається один раз, а записи тримають лише
+ * його номер. Таблиця лише доповнюється, тож номер не змінюється до
+ * завершення програми, а текст читається без блокування. Бінарний знімок
+ * зберігає лише символи своїх записів під щільними номерами (див.
+ * SymbolSubset), а ReadFrom перекладає їх у номери цього процесу.
+ */
+class SymbolTable {
+public:
+    /**
+     * @brief Повертає символ значення, додаючи його за першої появи
+     * @param text Значення
+     * @throw std::length_error Якщо таблицю переповнено
+     */
+    static Symbol Intern(std::string_view text);
+
+    /**
+     * @brief Шукає символ значення без додавання
+     * @param text Значення
+     * @param symbol Знайдений символ
+     * @return true якщо значення вже є в таблиці
+     */
+    static bool Find(std::string_view text, Symbol& symbol);
+
+    /**
+     * @brief Повертає текст символу
+     * @param symbol Символ
+     * @return Текст (порожній рядок для невідомого номера)
+     */
+    static const std::string& GetText(Symbol symbol);
+
+    /**
+     * @brief Повертає кількість значень у таблиці (разом із порожнім рядком)
+     */
+    static size_t GetCount();
+
+    /**
+     * @brief Читає таблицю символів знімка (SymbolSubset::WriteTo)
+     * @details Значення, яких ще немає в таблиці, додаються в порядку знімка.
+     * Номер знімка перекладається через symbols, тож знімок залишається
+     * придатним незалежно від порядку завантаження.
+     * @param reader Тіло знімка
+     * @param symbols Символ цього процесу для кожного номера знімка
+     * @return false якщо таблицю знімка пошкоджено
+     */
+    static bool ReadFrom(SnapshotReader& reader, std::vector<Symbol>& symbols);
+};
+
+/**
+ * @class SymbolSubset
+ * @brief Символи, використані в одному знімку, під щільними номерами
+ *
+ * Знімок колекції зберігає лише значення власних записів: спершу всі
+ * символи записів додаються через Add, потім таблиця пишеться через
+ * WriteTo, а поля записів - номерами з Encode. Номер 0 - порожній рядок.
+ */
+class SymbolSubset {
+private:
+    std::unordered_map<uint32_t, uint32_t> m_dense;  ///< Номер у SymbolTable -> номер у знімку
+    std::vector<Symbol> m_symbols;                   ///< Символи в порядку номерів знімка (без порожнього)
+
+public:
+    /**
+     * @brief Додає символ до таблиці знімка
+     */
+    void Add(Symbol symbol);
+
+    /**
+     * @brief Повертає номер символу в знімку (0 для не доданого символу)
+     */
+    uint32_t Encode(Symbol symbol) const;
+
+    /**
+     * @brief Записує таблицю символів у тіло знімка
+     * @param writer Тіло знімка
+     */
+    void WriteTo(SnapshotWriter& writer) const;
+};
+
+} // namespace University
+
+template <>
+struct std::hash<University::Symbol> {
+    size_t operator()(const University::Symbol& symbol) const noexcept
+    {
+        return std::hash<uint32_t>{}(symbol.id);
+    }
+};
+
+#endif // SYMBOLTABLE_H
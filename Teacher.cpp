@@ -5,46 +5,17 @@
 /// @namespace University
 
 #include "Teacher.h"
+#include "LifecycleTrace.h"
 #include <sstream>
 #include <algorithm>
 #include <iostream>
-#ifdef _WIN32
-#include <windows.h>
-#endif
 
 using namespace std;
 
 namespace University {
 
-bool Teacher::ukrainianSupportInitialized = false;
 const double Teacher::DEFAULT_WORKLOAD_HOURS = 180.0;
 
-void Teacher::initializeUkrainianSupport()
-{
-    if (ukrainianSupportInitialized) {
-        return;
-    }
-
-#ifdef _WIN32
-    SetConsoleOutputCP(CP_UTF8);
-    SetConsoleCP(CP_UTF8);
-#endif
-
-    try {
-        setlocale(LC_ALL, "uk_UA.UTF-8");
-    }
-    catch (...) {
-        try {
-            setlocale(LC_ALL, "C.UTF-8");
-        }
-        catch (...) {
-            setlocale(LC_ALL, "");
-        }
-    }
-
-    ukrainianSupportInitialized = true;
-}
-
 bool Teacher::validateTeacherID(const string& id) const
 {
     return !id.empty() && all_of(id.begin(), id.end(), [](char c) {
@@ -52,48 +23,63 @@ bool Teacher::validateTeacherID(const string& id) const
     });
 }
 
-Teacher::Teacher() : Person(), teacherID(""), department(""),
+Teacher::Teacher() : Person(), teacherID(""), department(),
                      academicDegree(AcademicDegree::BACHELOR)
 {
-    initializeUkrainianSupport();
+    TRACE_LIFECYCLE(Teacher, Construct);
 }
 
 Teacher::Teacher(const string& name, const string& lastName,
                  const string& email, const string& teacherID,
                  const string& department, AcademicDegree degree)
     : Person(name, lastName, email), teacherID(teacherID),
-      department(department), academicDegree(degree)
+      department(SymbolTable::Intern(department)), academicDegree(degree)
 {
-    initializeUkrainianSupport();
     if (!validateTeacherID(teacherID)) {
         throw invalid_argument("Некоректний ID викладача: " + teacherID);
     }
+    TRACE_LIFECYCLE(Teacher, Construct);
+}
+
+Teacher::Teacher(TrustedData trusted, const string& name, const string& lastName,
+                 const string& email, const string& teacherID,
+                 const string& department, AcademicDegree degree)
+    : Person(trusted, name, lastName, email), teacherID(teacherID),
+      department(SymbolTable::Intern(department)), academicDegree(degree)
+{
+    TRACE_LIFECYCLE(Teacher, Construct);
 }
 
 Teacher::Teacher(const Teacher& other)
     : Person(other), teacherID(other.teacherID),
       department(other.department), academicDegree(other.academicDegree)
 {
+    TRACE_LIFECYCLE(Teacher, Copy);
 }
 
 Teacher::Teacher(Teacher&& other) noexcept
     : Person(move(other)), teacherID(move(other.teacherID)),
-      department(move(other.department)), academicDegree(move(other.academicDegree))
+      department(other.department), academicDegree(move(other.academicDegree))
 {
+    TRACE_LIFECYCLE(Teacher, Move);
 }
 
 Teacher::~Teacher()
 {
-    cout << "Об'єкт Teacher знищено: " << getName() << " "
-         << getLastName() << " (" << teacherID << ")" << endl;
+    TRACE_LIFECYCLE(Teacher, Destroy);
 }
 
-[[nodiscard]] string Teacher::getTeacherID() const
+[[nodiscard]] const string& Teacher::getTeacherID() const
 {
     return teacherID;
 }
 
-[[nodiscard]] string Teacher::getDepartment() const
+[[nodiscard]] const string& Teacher::getDepartment() const
+{
+    return department.GetText();
+}
+
+[[nodiscard]] Symbol Teacher::getDepartmentSymbol() const
 {
     return department;
 }
@@ -130,7 +116,7 @@ void Teacher::setDepartment(const string& dep)
     if (dep.empty()) {
         throw invalid_argument("Кафедра не може бути порожньою");
     }
-    department = dep;
+    department = SymbolTable::Intern(dep);
 }
 
 void Teacher::setAcademicDegree(AcademicDegree deg)
@@ -173,7 +159,7 @@ void Teacher::print() const
 {
     cout << "Викладач: " << getFullName() << endl;
     cout << "ID: " << teacherID << endl;
-    cout << "Кафедра: " << department << endl;
+    cout << "Кафедра: " << department.GetText() << endl;
     cout << "Науковий ступінь: " << getAcademicDegreeString() << endl;
     cout << "Статус: " << getTeachingStatus() << endl;
     cout << "Навантаження: " << calculateWorkload() << " годин" << endl;
@@ -183,7 +169,7 @@ void Teacher::print() const
 {
     stringstream ss;
     ss << "Teacher{name: " << getName() << ", lastName: " << getLastName()
-       << ", teacherID: " << teacherID << ", department: " << department
+       << ", teacherID: " << teacherID << ", department: " << department.GetText()
        << ", degree: " << getAcademicDegreeString() << ", status: "
        << getTeachingStatus() << ", workload: " << calculateWorkload() << "}";
     return ss.str();
@@ -191,7 +177,7 @@ void Teacher::print() const
 
 [[nodiscard]] bool Teacher::isValid() const
 {
-    return Person::isValid() && !teacherID.empty() && !department.empty();
+    return Person::isValid() && !teacherID.empty() && !department.IsEmpty();
 }
 
 Teacher& Teacher::operator=(const Teacher& other)
@@ -201,6 +187,7 @@ Teacher& Teacher::operator=(const Teacher& other)
         teacherID = other.teacherID;
         department = other.department;
         academicDegree = other.academicDegree;
+        TRACE_LIFECYCLE(Teacher, Copy);
     }
     return *this;
 }
@@ -210,8 +197,9 @@ Teacher& Teacher::operator=(Teacher&& other) noexcept
     if (this != &other) {
         Person::operator=(move(other));
         teacherID = move(other.teacherID);
-        department = move(other.department);
+        department = other.department;
         academicDegree = move(other.academicDegree);
+        TRACE_LIFECYCLE(Teacher, Move);
     }
     return *this;
 }
@@ -8,6 +8,7 @@
 #define TEACHER_H
 
 #include "Person.h"
+#include "SymbolTable.h"
 #include <string>
 
 namespace University {
@@ -25,15 +26,11 @@ enum class AcademicDegree {
 class Teacher : public Person {
 private:
     std::string teacherID;        ///< Ідентифікатор викладача
-    std::string department;       ///< Кафедра викладача
+    Symbol department;            ///< Кафедра викладача (символ)
     AcademicDegree academicDegree; ///< Академічний ступінь
 
-    static bool ukrainianSupportInitialized;           ///< Стан ініціалізації української підтримки
     static const double DEFAULT_WORKLOAD_HOURS;        ///< Стандартна кількість годин навантаження
 
-    /// @brief Ініціалізація української підтримки
-    void initializeUkrainianSupport();
-
     /// @brief Валідація ідентифікатора викладача
     /// @param id Ідентифікатор для перевірки
     /// @return Результат валідації
@@ -54,6 +51,17 @@ public:
             const std::string& email, const std::string& teacherID,
             const std::string& department, AcademicDegree degree);
 
+    /// @brief Конструктор з вже перевіреними даними (без валідації)
+    /// @param name          Ім'я викладача
+    /// @param lastName      Прізвище викладача
+    /// @param email         Електронна пошта
+    /// @param teacherID     Ідентифікатор викладача
+    /// @param department    Кафедра
+    /// @param degree        Академічний ступінь
+    Teacher(TrustedData, const std::string& name, const std::string& lastName,
+            const std::string& email, const std::string& teacherID,
+            const std::string& department, AcademicDegree degree);
+
     /// @brief Конструктор копіювання
     /// @param other Об'єкт для копіювання
     Teacher(const Teacher& other);
@@ -66,8 +74,9 @@ public:
     ~Teacher() override;
 
     // Геттери
-    [[nodiscard]] std::string getTeacherID() const;
-    [[nodiscard]] std::string getDepartment() const;
+    [[nodiscard]] const std::string& getTeacherID() const;
+    [[nodiscard]] const std::string& getDepartment() const;
+    [[nodiscard]] Symbol getDepartmentSymbol() const;
     [[nodiscard]] AcademicDegree getAcademicDegree() const;
 
     // Сеттери
@@ -0,0 +1,223 @@
+#include "TextUtils.h"
+
+#if defined(__SSE2__) || defined(_M_X64) || (defined(_M_IX86_FP) && _M_IX86_FP >= 2)
+    #include <emmintrin.h>
+    #define TEXT_USE_SSE2
+#endif
+
+using namespace std;
+
+namespace University {
+
+namespace {
+
+/**
+ * @brief Повертає малу літеру для великої латинської або кириличної літери
+ */
+char32_t FoldCodePoint(char32_t cp)
+{
+    // Latin-1: À-Þ, крім знака множення
+    if (cp >= 0x00C0 && cp <= 0x00DE && cp != 0x00D7)
+    {
+        return cp + 0x20;
+    }
+    // Latin Extended-A: пари "велика - мала" з великою на парній позиції
+    if ((cp >= 0x0100 && cp <= 0x012F) || (cp >= 0x0132 && cp <= 0x0137) ||
+        (cp >= 0x014A && cp <= 0x0177))
+    {
+        return cp | 1;
+    }
+    // ... та на непарній позиції
+    if ((cp >= 0x0139 && cp <= 0x0148) || (cp >= 0x0179 && cp <= 0x017E))
+    {
+        return (cp & 1) ? cp + 1 : cp;
+    }
+    if (cp == 0x0178)
+    {
+        return 0x00FF;
+    }
+    // Кирилиця: Ѐ-Џ (зокрема Є, І, Ї) та А-Я
+    if (cp >= 0x0400 && cp <= 0x040F)
+    {
+        return cp + 0x50;
+    }
+    if (cp >= 0x0410 && cp <= 0x042F)
+    {
+        return cp + 0x20;
+    }
+    // Розширена кирилиця (зокрема Ґ): пари з великою на парній позиції
+    if ((cp >= 0x0460 && cp <= 0x0481) || (cp >= 0x048A && cp <= 0x04BF) ||
+        (cp >= 0x04D0 && cp <= 0x052F))
+    {
+        return cp | 1;
+    }
+    if (cp == 0x04C0)
+    {
+        return 0x04CF;
+    }
+    if (cp >= 0x04C1 && cp <= 0x04CE)
+    {
+        return (cp & 1) ? cp + 1 : cp;
+    }
+    return cp;
+}
+
+void AppendCodePoint(string& result, char32_t cp)
+{
+    if (cp < 0x80)
+    {
+        result += static_cast<char>(cp);
+    }
+    else if (cp < 0x800)
+    {
+        result += static_cast<char>(0xC0 | (cp >> 6));
+        result += static_cast<char>(0x80 | (cp & 0x3F));
+    }
+    else if (cp < 0x10000)
+    {
+        result += static_cast<char>(0xE0 | (cp >> 12));
+        result += static_cast<char>(0x80 | ((cp >> 6) & 0x3F));
+        result += static_cast<char>(0x80 | (cp & 0x3F));
+    }
+    else
+    {
+        result += static_cast<char>(0xF0 | (cp >> 18));
+        result += static_cast<char>(0x80 | ((cp >> 12) & 0x3F));
+        result += static_cast<char>(0x80 | ((cp >> 6) & 0x3F));
+        result += static_cast<char>(0x80 | (cp & 0x3F));
+    }
+}
+
+/**
+ * @brief Декодує символ UTF-8
+ * @return Довжина послідовності в байтах або 0, якщо вона некоректна
+ */
+size_t DecodeCodePoint(const unsigned char* cursor, const unsigned char* end, char32_t& cp)
+{
+    unsigned char lead = cursor[0];
+    size_t length;
+    char32_t minimum;
+    if (lead >= 0xC2 && lead <= 0xDF)
+    {
+        length = 2;
+        cp = lead & 0x1F;
+        minimum = 0x80;
+    }
+    else if (lead >= 0xE0 && lead <= 0xEF)
+    {
+        length = 3;
+        cp = lead & 0x0F;
+        minimum = 0x800;
+    }
+    else if (lead >= 0xF0 && lead <= 0xF4)
+    {
+        length = 4;
+        cp = lead & 0x07;
+        minimum = 0x10000;
+    }
+    else
+    {
+        return 0;
+    }
+
+    if (static_cast<size_t>(end - cursor) < length)
+    {
+        return 0;
+    }
+    for (size_t i = 1; i < length; i++)
+    {
+        if ((cursor[i] & 0xC0) != 0x80)
+        {
+            return 0;
+        }
+        cp = (cp << 6) | (cursor[i] & 0x3F);
+    }
+    if (cp < minimum || cp > 0x10FFFF || (cp >= 0xD800 && cp <= 0xDFFF))
+    {
+        return 0;
+    }
+    return length;
+}
+
+} // namespace
+
+string TextUtils::FoldCase(string_view text)
+{
+    string result;
+    AppendFolded(result, text);
+    return result;
+}
+
+void TextUtils::AppendFolded(string& result, string_view text)
+{
+    const unsigned char* cursor = reinterpret_cast<const unsigned char*>(text.data());
+    const unsigned char* end = cursor + text.size();
+    result.reserve(result.size() + text.size());
+
+    while (cursor < end)
+    {
+#ifdef TEXT_USE_SSE2
+        // Блоки лише з ASCII: A-Z перетворюються додаванням 0x20 без розгалужень
+        const __m128i beforeUpper = _mm_set1_epi8('A' - 1);
+        const __m128i afterUpper = _mm_set1_epi8('Z' + 1);
+        const __m128i caseBit = _mm_set1_epi8(0x20);
+        while (end - cursor >= 16)
+        {
+            __m128i chunk = _mm_loadu_si128(reinterpret_cast<const __m128i*>(cursor));
+            if (_mm_movemask_epi8(chunk) != 0)
+            {
+                break;
+            }
+            __m128i upper = _mm_and_si128(_mm_cmpgt_epi8(chunk, beforeUpper),
+                                          _mm_cmplt_epi8(chunk, afterUpper));
+            chunk = _mm_add_epi8(chunk, _mm_and_si128(upper, caseBit));
+
+            char folded[16];
+            _mm_storeu_si128(reinterpret_cast<__m128i*>(folded), chunk);
+            result.append(folded, sizeof(folded));
+            cursor += 16;
+        }
+        if (cursor == end)
+        {
+            break;
+        }
+#endif
+
+        unsigned char c = *cursor;
+        if (c < 0x80)
+        {
+            result += static_cast<char>(c >= 'A' && c <= 'Z' ? c + 0x20 : c);
+            cursor++;
+            continue;
+        }
+
+        char32_t cp;
+        size_t length = DecodeCodePoint(cursor, end, cp);
+        if (length == 0)
+        {
+            result += static_cast<char>(c);
+            cursor++;
+            continue;
+        }
+        AppendCodePoint(result, FoldCodePoint(cp));
+        cursor += length;
+    }
+}
+
+size_t TextUtils::NextCodePoint(string_view text, size_t position, char32_t& codePoint)
+{
+    const unsigned char* cursor = reinterpret_cast<const unsigned char*>(text.data()) + position;
+    const unsigned char* end = reinterpret_cast<const unsigned char*>(text.data()) + text.size();
+    if (*cursor >= 0x80)
+    {
+        size_t length = DecodeCodePoint(cursor, end, codePoint);
+        if (length != 0)
+        {
+            return length;
+        }
+    }
+    codePoint = *cursor;
+    return 1;
+}
+
+} // namespace University
@@ -0,0 +1,52 @@
+/**
+ * @file TextUtils.h
+ * @brief Заголовний файл з допоміжними функціями для роботи з текстом UTF-8
+ */
+
+#ifndef TEXTUTILS_H
+#define TEXTUTILS_H
+
+#include <string>
+#include <string_view>
+
+namespace University {
+
+/**
+ * @class TextUtils
+ * @brief Допоміжні операції над текстом у кодуванні UTF-8
+ */
+class TextUtils {
+public:
+    /**
+     * @brief Приводить текст до нижнього регістру для порівняння без урахування регістру
+     * @details Підтримуються ASCII, латиниця (Latin-1, Latin Extended-A) та
+     * кирилиця, зокрема українські літери Є, І, Ї, Ґ. Фрагменти лише з ASCII
+     * обробляються по 16 байтів за раз (SSE2), якщо компілятор дозволяє ці
+     * інструкції. Некоректні послідовності UTF-8 копіюються без змін.
+     * @param text Текст у кодуванні UTF-8
+     * @return Текст у нижньому регістрі
+     */
+    static std::string FoldCase(std::string_view text);
+
+    /**
+     * @brief Дописує текст у нижньому регістрі до рядка
+     * @param result Рядок, що формується
+     * @param text Текст у кодуванні UTF-8
+     */
+    static void AppendFolded(std::string& result, std::string_view text);
+
+    /**
+     * @brief Читає символ UTF-8, що починається з вказаної позиції
+     * @details Байт некоректної послідовності повертається як окремий символ
+     * з кодом цього байта, тож текст завжди розбирається до кінця.
+     * @param text Текст у кодуванні UTF-8
+     * @param position Позиція першого байта символу (менша за довжину тексту)
+     * @param codePoint Прочитаний код символу
+     * @return Кількість байтів символу (від 1 до 4)
+     */
+    static size_t NextCodePoint(std::string_view text, size_t position, char32_t& codePoint);
+};
+
+} // namespace University
+
+#endif // TEXTUTILS_H
@@ -0,0 +1,163 @@
+#include "ThreadPool.h"
+
+#include <algorithm>
+#include <atomic>
+#include <exception>
+#include <memory>
+
+using namespace std;
+
+namespace University {
+
+namespace {
+
+/**
+ * @brief Спільний стан одного виклику ParallelFor
+ * @details Належить усім учасникам: завдання в черзі пулу може почати
+ * виконання вже після повернення з ParallelFor і лише побачить, що номерів
+ * не залишилося.
+ */
+struct ParallelForState {
+    const function<void(size_t)>* task;   ///< Завдання (дійсне, доки є невиконані номери)
+    size_t count;                         ///< Кількість номерів
+    atomic<size_t> next{0};               ///< Наступний номер для виконання
+    size_t finished = 0;                  ///< Кількість виконаних номерів
+    exception_ptr error;                  ///< Перший виняток завдання
+    mutex doneMutex;                      ///< Захищає finished та error
+    condition_variable doneCondition;     ///< Сповіщення про виконання всіх номерів
+};
+
+/**
+ * @brief Виконує номери, доки вони не закінчаться
+ */
+void DrainParallelFor(ParallelForState& state)
+{
+    size_t completed = 0;
+    exception_ptr error;
+    size_t index;
+    while ((index = state.next.fetch_add(1)) < state.count)
+    {
+        try
+        {
+            (*state.task)(index);
+        }
+        catch (...)
+        {
+            if (!error)
+            {
+                error = current_exception();
+            }
+        }
+        completed++;
+    }
+    if (completed == 0)
+    {
+        return;
+    }
+
+    lock_guard<mutex> lock(state.doneMutex);
+    if (error && !state.error)
+    {
+        state.error = error;
+    }
+    state.finished += completed;
+    if (state.finished == state.count)
+    {
+        state.doneCondition.notify_all();
+    }
+}
+
+} // namespace
+
+ThreadPool::ThreadPool(size_t threadCount)
+    : m_stopping(false)
+{
+    if (threadCount == 0)
+    {
+        threadCount = max(1u, thread::hardware_concurrency());
+    }
+    m_workers.reserve(threadCount);
+    for (size_t i = 0; i < threadCount; i++)
+    {
+        m_workers.emplace_back(&ThreadPool::Run, this);
+    }
+}
+
+ThreadPool::~ThreadPool()
+{
+    {
+        lock_guard<mutex> lock(m_mutex);
+        m_stopping = true;
+    }
+    m_wakeCondition.notify_all();
+    for (auto& worker : m_workers)
+    {
+        worker.join();
+    }
+}
+
+size_t ThreadPool::GetThreadCount() const
+{
+    return m_workers.size();
+}
+
+void ThreadPool::Submit(function<void()> task)
+{
+    {
+        lock_guard<mutex> lock(m_mutex);
+        m_tasks.push_back(std::move(task));
+    }
+    m_wakeCondition.notify_one();
+}
+
+void ThreadPool::ParallelFor(size_t count, const function<void(size_t)>& task)
+{
+    if (count == 0)
+    {
+        return;
+    }
+    if (count == 1)
+    {
+        task(0);
+        return;
+    }
+
+    auto state = make_shared<ParallelForState>();
+    state->task = &task;
+    state->count = count;
+
+    size_t helpers = min(count - 1, m_workers.size());
+    for (size_t i = 0; i < helpers; i++)
+    {
+        Submit([state] { DrainParallelFor(*state); });
+    }
+    DrainParallelFor(*state);
+
+    unique_lock<mutex> lock(state->doneMutex);
+    state->doneCondition.wait(lock, [&state] { return state->finished == state->count; });
+    if (state->error)
+    {
+        rethrow_exception(state->error);
+    }
+}
+
+void ThreadPool::Run()
+{
+    while (true)
+    {
+        function<void()> task;
+        {
+            unique_lock<mutex> lock(m_mutex);
+            m_wakeCondition.wait(lock, [this] { return m_stopping || !m_tasks.empty(); });
+            if (m_tasks.empty())
+            {
+                return;
+            }
+            task = std::move(m_tasks.front());
+            m_tasks.pop_front();
+        }
+        task();
+    }
+}
+
+} // namespace University
@@ -0,0 +1,79 @@
+/**
+ * @file ThreadPool.h
+ * @brief Заголовний файл для спільного пулу робочих потоків
+ */
+
+#ifndef THREADPOOL_H
+#define THREADPOOL_H
+
+#include <condition_variable>
+#include <deque>
+#include <functional>
+#include <mutex>
+#include <thread>
+#include <vector>
+
+namespace University {
+
+/**
+ * @class ThreadPool
+ * @brief Пул робочих потоків, спільний для всієї програми
+ *
+ * Потоки створюються один раз і виконують завдання з черги, тож паралельний
+ * перегляд колекції не платить за створення потоків при кожному запиті.
+ * ParallelFor() виконує частину завдань у потоці, що його викликав, тому
+ * вкладені виклики не блокуються навіть тоді, коли всі потоки пулу зайняті.
+ */
+class ThreadPool {
+private:
+    std::vector<std::thread> m_workers;             ///< Робочі потоки
+    std::deque<std::function<void()>> m_tasks;      ///< Черга завдань
+    std::mutex m_mutex;                             ///< Захищає чергу та прапор завершення
+    std::condition_variable m_wakeCondition;        ///< Пробудження робочих потоків
+    bool m_stopping;                                ///< Прапор завершення роботи
+
+    /**
+     * @brief Основний цикл робочого потоку
+     */
+    void Run();
+
+public:
+    /**
+     * @brief Конструктор з параметрами, запускає робочі потоки
+     * @param threadCount Кількість потоків (0 - за кількістю ядер процесора)
+     */
+    explicit ThreadPool(size_t threadCount = 0);
+
+    ThreadPool(const ThreadPool&) = delete;
+    ThreadPool& operator=(const ThreadPool&) = delete;
+
+    /**
+     * @brief Деструктор
+     * @details Виконує завдання, що залишилися в черзі, та зупиняє потоки
+     */
+    ~ThreadPool();
+
+    /**
+     * @brief Повертає кількість робочих потоків
+     */
+    size_t GetThreadCount() const;
+
+    /**
+     * @brief Додає завдання до черги
+     * @param task Завдання
+     */
+    void Submit(std::function<void()> task);
+
+    /**
+     * @brief Виконує завдання з номерами [0, count) і чекає їх завершення
+     * @details Поточний потік теж виконує завдання. Якщо завдання кинуло
+     * виняток, решта завдань виконується, а перший виняток кидається повторно.
+     * @param count Кількість завдань
+     * @param task Завдання, що отримує свій номер
+     */
+    void ParallelFor(size_t count, const std::function<void(size_t)>& task);
+};
+
+} // namespace University
+
+#endif // THREADPOOL_H
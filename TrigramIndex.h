@@ -0,0 +1,328 @@
+/**
+ * @file TrigramIndex.h
+ * @brief Заголовний файл для триграмного індексу пошуку за частиною назви
+ */
+
+#ifndef TRIGRAMINDEX_H
+#define TRIGRAMINDEX_H
+
+#include "SlotMap.h"
+#include <algorithm>
+#include <cstdint>
+#include <string>
+#include <string_view>
+#include <unordered_map>
+#include <vector>
+
+namespace University {
+
+/**
+ * @class TrigramIndex
+ * @brief Інвертований індекс триграм нормалізованих назв записів
+ *
+ * Для кожної послідовності з трьох байтів назви зберігається
+ * невпорядкований список слотів записів, що її містять. Запис пам'ятає свою
+ * позицію в кожному списку, тож додавання й видалення коштують O(1) на
+ * триграму (видалення переносить на звільнене місце останній слот). Пошук
+ * підрядка бере найкоротший список триграм запиту і залишає лише записи,
+ * що мають решту триграм. Нормалізовані назви зберігаються в індексі
+ * (одна згорнута копія назви на запис понад текст у пулі таблиці), тож
+ * перевірка не створює тимчасових рядків. Запити, коротші за три
+ * байти, перевіряються за збереженими назвами всіх записів.
+ *
+ * @tparam T Тип запису
+ */
+template <typename T>
+class TrigramIndex {
+public:
+    using KeyFunction = std::string (*)(const T&);  ///< Обчислює нормалізовану назву запису
+
+private:
+    /**
+     * @struct Entry
+     * @brief Проіндексована назва запису в слоті
+     */
+    struct Entry {
+        uint32_t generation = 0;          ///< Покоління дескриптора запису
+        bool present = false;             ///< Чи проіндексовано запис у цьому слоті
+        std::string text;                 ///< Нормалізована назва
+        std::vector<uint32_t> trigrams;   ///< Відсортовані унікальні триграми назви
+        std::vector<uint32_t> positions;  ///< Позиція слота у списку кожної триграми
+
+        bool Has(uint32_t trigram) const
+        {
+            return std::binary_search(trigrams.begin(), trigrams.end(), trigram);
+        }
+    };
+
+    KeyFunction m_keyOf;                                           ///< Функція нормалізованої назви
+    std::vector<Entry> m_entries;                                  ///< Слот -> назва запису
+    std::unordered_map<uint32_t, std::vector<uint32_t>> m_postings; ///< Триграма -> слоти записів
+    size_t m_size = 0;                                             ///< Кількість проіндексованих записів
+
+    static uint32_t Trigram(std::string_view text, size_t position)
+    {
+        return static_cast<uint32_t>(static_cast<unsigned char>(text[position])) << 16 |
+               static_cast<uint32_t>(static_cast<unsigned char>(text[position + 1])) << 8 |
+               static_cast<uint32_t>(static_cast<unsigned char>(text[position + 2]));
+    }
+
+    static std::vector<uint32_t> UniqueTrigrams(std::string_view text)
+    {
+        std::vector<uint32_t> trigrams;
+        if (text.size() >= 3)
+        {
+            trigrams.reserve(text.size() - 2);
+            for (size_t i = 0; i + 3 <= text.size(); i++)
+            {
+                trigrams.push_back(Trigram(text, i));
+            }
+            std::sort(trigrams.begin(), trigrams.end());
+            trigrams.erase(std::unique(trigrams.begin(), trigrams.end()), trigrams.end());
+        }
+        return trigrams;
+    }
+
+    void Add(std::string text, Handle<T> handle)
+    {
+        if (handle.slot >= m_entries.size())
+        {
+            m_entries.resize(handle.slot + 1);
+        }
+        Entry& entry = m_entries[handle.slot];
+        entry.trigrams = UniqueTrigrams(text);
+        entry.positions.resize(entry.trigrams.size());
+        for (size_t i = 0; i < entry.trigrams.size(); i++)
+        {
+            auto& slots = m_postings[entry.trigrams[i]];
+            entry.positions[i] = static_cast<uint32_t>(slots.size());
+            slots.push_back(handle.slot);
+        }
+        entry.generation = handle.generation;
+        entry.present = true;
+        entry.text = std::move(text);
+        m_size++;
+    }
+
+    void Remove(Handle<T> handle)
+    {
+        if (handle.slot >= m_entries.size())
+        {
+            return;
+        }
+        Entry& entry = m_entries[handle.slot];
+        if (!entry.present || entry.generation != handle.generation)
+        {
+            return;
+        }
+        for (size_t i = 0; i < entry.trigrams.size(); i++)
+        {
+            auto posting = m_postings.find(entry.trigrams[i]);
+            auto& slots = posting->second;
+            uint32_t position = entry.positions[i];
+            uint32_t moved = slots.back();
+            slots[position] = moved;
+            slots.pop_back();
+            if (moved != handle.slot)
+            {
+                // Оновлюємо позицію перенесеного слота саме в списку цієї триграми
+                Entry& movedEntry = m_entries[moved];
+                auto it = std::lower_bound(movedEntry.trigrams.begin(), movedEntry.trigrams.end(),
+                                           entry.trigrams[i]);
+                movedEntry.positions[static_cast<size_t>(it - movedEntry.trigrams.begin())] = position;
+            }
+            if (slots.empty())
+            {
+                m_postings.erase(posting);
+            }
+        }
+        entry.present = false;
+        entry.text.clear();
+        entry.trigrams.clear();
+        entry.positions.clear();
+        m_size--;
+    }
+
+public:
+    /**
+     * @brief Конструктор з параметрами
+     * @param keyOf Функція, що обчислює нормалізовану назву запису
+     */
+    explicit TrigramIndex(KeyFunction keyOf) : m_keyOf(keyOf) {}
+
+    /**
+     * @brief Індексує назву запису
+     */
+    void Insert(const T& record, Handle<T> handle)
+    {
+        Add(m_keyOf(record), handle);
+    }
+
+    /**
+     * @brief Видаляє запис з індексу (використовується збережена назва)
+     */
+    void Erase(const T&, Handle<T> handle)
+    {
+        Remove(handle);
+    }
+
+    /**
+     * @brief Очищає індекс
+     */
+    void Clear()
+    {
+        m_entries.clear();
+        m_postings.clear();
+        m_size = 0;
+    }
+
+    /**
+     * @brief Знаходить записи, нормалізована назва яких містить запит
+     * @param query Нормалізований запит
+     * @return Дескриптори знайдених записів (у довільному порядку)
+     */
+    std::vector<Handle<T>> Search(std::string_view query) const
+    {
+        std::vector<Handle<T>> result;
+        auto collect = [this, &result, query](uint32_t slot)
+        {
+            const Entry& entry = m_entries[slot];
+            if (entry.present && entry.text.find(query) != std::string::npos)
+            {
+                result.push_back(Handle<T>{slot, entry.generation});
+            }
+        };
+
+        std::vector<uint32_t> trigrams = UniqueTrigrams(query);
+        if (trigrams.empty())
+        {
+            for (uint32_t slot = 0; slot < m_entries.size(); slot++)
+            {
+                collect(slot);
+            }
+            return result;
+        }
+
+        const std::vector<uint32_t>* shortest = nullptr;
+        for (uint32_t trigram : trigrams)
+        {
+            auto posting = m_postings.find(trigram);
+            if (posting == m_postings.end())
+            {
+                return result;
+            }
+            if (shortest == nullptr || posting->second.size() < shortest->size())
+            {
+                shortest = &posting->second;
+            }
+        }
+
+        // Решту триграм перевіряємо за відсортованим списком триграм кожного кандидата,
+        // тож довгі списки не потрібно ні сортувати, ні обходити
+        std::vector<uint32_t> candidates = *shortest;
+        std::sort(candidates.begin(), candidates.end());
+        for (uint32_t slot : candidates)
+        {
+            const Entry& entry = m_entries[slot];
+            bool hasAll = std::all_of(trigrams.begin(), trigrams.end(),
+                [&entry](uint32_t trigram) { return entry.Has(trigram); });
+            // Наявність усіх триграм не гарантує їхнього порядку в назві
+            if (hasAll)
+            {
+                collect(slot);
+            }
+        }
+        return result;
+    }
+
+    /**
+     * @brief Оцінює кількість кандидатів для запиту без їх збору
+     * @param query Нормалізований запит
+     * @return Довжина найкоротшого списку триграм запиту (верхня межа результату)
+     */
+    size_t EstimateCandidates(std::string_view query) const
+    {
+        std::vector<uint32_t> trigrams = UniqueTrigrams(query);
+        if (trigrams.empty())
+        {
+            return m_size;
+        }
+        size_t estimate = m_size;
+        for (uint32_t trigram : trigrams)
+        {
+            auto posting = m_postings.find(trigram);
+            estimate = std::min(estimate, posting != m_postings.end() ? posting->second.size() : size_t(0));
+        }
+        return estimate;
+    }
+
+    /**
+     * @brief Обходить записи, назви яких мають майже всі триграми запиту
+     * @details Використовується для нечіткого пошуку: якщо кожна правка запиту
+     * руйнує обмежену кількість його триграм, назва зі збігом у межах відстані
+     * містить усі триграми, крім не більше ніж maxMissing. Якщо триграм запиту
+     * не більше за maxMissing, обходяться всі записи.
+     * @param query Нормалізований запит
+     * @param maxMissing Кількість різних триграм запиту, яких може не бути в назві
+     * @param visit Функція visit(дескриптор, нормалізована назва)
+     */
+    template <typename Visitor>
+    void ForEachSharing(std::string_view query, size_t maxMissing, Visitor visit) const
+    {
+        std::vector<uint32_t> trigrams = UniqueTrigrams(query);
+        if (trigrams.size() <= maxMissing)
+        {
+            for (uint32_t slot = 0; slot < m_entries.size(); slot++)
+            {
+                const Entry& entry = m_entries[slot];
+                if (entry.present)
+                {
+                    visit(Handle<T>{slot, entry.generation}, entry.text);
+                }
+            }
+            return;
+        }
+
+        // Слот потрапляє до кандидатів, щойно набирає потрібну кількість спільних триграм
+        const size_t required = trigrams.size() - maxMissing;
+        std::vector<uint32_t> shared(m_entries.size(), 0);
+        std::vector<uint32_t> candidates;
+        for (uint32_t trigram : trigrams)
+        {
+            auto posting = m_postings.find(trigram);
+            if (posting == m_postings.end())
+            {
+                continue;
+            }
+            for (uint32_t slot : posting->second)
+            {
+                if (++shared[slot] == required)
+                {
+                    candidates.push_back(slot);
+                }
+            }
+        }
+
+        std::sort(candidates.begin(), candidates.end());
+        for (uint32_t slot : candidates)
+        {
+            const Entry& entry = m_entries[slot];
+            if (entry.present)
+            {
+                visit(Handle<T>{slot, entry.generation}, entry.text);
+            }
+        }
+    }
+
+    /**
+     * @brief Повертає кількість проіндексованих записів
+     */
+    size_t Size() const
+    {
+        return m_size;
+    }
+};
+
+} // namespace University
+
+#endif // TRIGRAMINDEX_H
@@ -0,0 +1,22 @@
+/**
+ * @file TrustedData.h
+ * @brief Заголовний файл з тегом конструкторів для вже перевірених даних
+ */
+
+#ifndef TRUSTEDDATA_H
+#define TRUSTEDDATA_H
+
+namespace University {
+
+    /**
+     * @struct TrustedData
+     * @brief Тег для конструкторів, що приймають вже перевірені дані
+     *
+     * Використовується під час завантаження бінарного знімка бази даних,
+     * де всі записи пройшли валідацію ще до збереження.
+     */
+    struct TrustedData {};
+
+} // namespace University
+
+#endif // TRUSTEDDATA_H
@@ -7,11 +7,49 @@
 #include <unordered_map>
 
 #include "MenuManager.h"
+#include "Csv.h"
 
 using namespace std;
 
 namespace University {
 
+namespace {
+
+/**
+ * @brief Розбирає рядок файлу користувачів "ім'я:пароль:роль"
+ * @details Файли, записані до появи екранування, не беруть поля в лапки,
+ * тож лапка в паролі там - звичайний символ. Якщо рядок не розбирається як
+ * CSV з трьома полями, він ділиться за першими двома двокрапками, як раніше.
+ * @return true якщо рядок містить три поля
+ */
+bool ParseUserLine(const string& line, string& username, string& password, string& role)
+{
+    CsvReader reader(line, ':');
+    if (reader.Next() && reader.GetFieldCount() == 3)
+    {
+        username = string(reader.GetField(0));
+        password = string(reader.GetField(1));
+        role = string(reader.GetField(2));
+        if (!reader.Next())
+        {
+            return true;
+        }
+    }
+
+    size_t first = line.find(':');
+    size_t second = first != string::npos ? line.find(':', first + 1) : string::npos;
+    if (second == string::npos)
+    {
+        return false;
+    }
+    username = line.substr(0, first);
+    password = line.substr(first + 1, second - first - 1);
+    role = line.substr(second + 1);
+    return true;
+}
+
+} // namespace
+
 const string UserManager::ERROR_EMPTY_USERNAME = "ПОМИЛКА: Ім'я користувача не може бути порожнім";
 const string UserManager::ERROR_USER_EXISTS = "ПОМИЛКА: Користувач вже існує";
 const string UserManager::ERROR_USER_NOT_FOUND = "ПОМИЛКА: Користувача не знайдено";
@@ -29,16 +67,18 @@ UserData::UserData(const string& pwd, UserRole r) : password(pwd), role(r)
 {
 }
 
-UserManager::UserManager()
+UserManager::UserManager() : m_loadState(LoadState::NotLoaded)
 {
     InitializeDefaultAdmin();
 }
 
-UserManager::UserManager(const UserManager& other) : m_users(other.m_users)
+UserManager::UserManager(const UserManager& other)
+    : m_users(other.m_users), m_loadState(other.m_loadState)
 {
 }
 
-UserManager::UserManager(UserManager&& other) noexcept : m_users(std::move(other.m_users))
+UserManager::UserManager(UserManager&& other) noexcept
+    : m_users(std::move(other.m_users)), m_loadState(other.m_loadState)
 {
 }
 
@@ -86,6 +126,17 @@ UserRole UserManager::StringToRole(const string& roleStr) const
     return UserRole::Student;
 }
 
+string UserManager::FormatUserRecord(const string& username, const UserData& userData) const
+{
+    string line;
+    CsvWriter::AppendField(line, username, ':');
+    line += ':';
+    CsvWriter::AppendField(line, userData.password, ':');
+    line += ':';
+    CsvWriter::AppendField(line, RoleToString(userData.role), ':');
+    return line;
+}
+
 string UserManager::AddUser(const string& username, const string& password, UserRole role)
 {
     if (username.empty())
@@ -256,8 +307,7 @@ string UserManager::ExportUsers(const string& filename) const
 
     for (const auto& user : m_users)
     {
-        file << user.first << ":" << user.second.password << ":"
-             << RoleToString(user.second.role) << "\n";
+        file << FormatUserRecord(user.first, user.second) << "\n";
     }
 
     file.close();
@@ -274,8 +324,7 @@ string UserManager::SaveUsersToFile(const string& filename) const
 
     for (const auto& user : m_users)
     {
-        file << user.first << ":" << user.second.password << ":"
-             << RoleToString(user.second.role) << "\n";
+        file << FormatUserRecord(user.first, user.second) << "\n";
     }
 
     file.close();
@@ -346,43 +395,60 @@ string UserManager::LoadUsersFromFile(const string& filename)
     if (!file.is_open())
     {
         SaveUsersToFile(filename);
+        m_loadState = LoadState::Loaded;
         return "ІНФО: Файл не знайдено. Створено новий файл з адміністратором.";
     }
 
     std::unordered_map<std::string, UserData> tempUsers;
-    string line;
     int loadedCount = 0;
 
+    // Поля користувачів не містять переносів рядка, тож кожен рядок - окремий запис
+    string line;
     while (getline(file, line))
     {
-        if (line.empty())
+        if (!line.empty() && line.back() == '\r')
         {
-            continue;
+            line.pop_back();
         }
 
-        stringstream ss(line);
         string username;
         string password;
         string roleStr;
+        if (line.empty() || !ParseUserLine(line, username, password, roleStr))
+        {
+            continue;
+        }
 
-        if (getline(ss, username, ':') && getline(ss, password, ':') && getline(ss, roleStr))
+        if (!username.empty() && !password.empty())
         {
-            if (!username.empty() && !password.empty())
-            {
-                UserRole role = StringToRole(roleStr);
-                tempUsers[username] = UserData(password, role);
-                loadedCount++;
-            }
+            UserRole role = StringToRole(roleStr);
+            tempUsers[username] = UserData(password, role);
+            loadedCount++;
         }
     }
 
     file.close();
     m_users = tempUsers;
     InitializeDefaultAdmin();
+    m_loadState = LoadState::Loaded;
 
     return "УСПІХ: Завантажено " + to_string(loadedCount) + " користувачів з файлу: " + filename;
 }
 
+string UserManager::Open()
+{
+    if (m_loadState == LoadState::Loaded)
+    {
+        return "ІНФО: Користувачів вже завантажено";
+    }
+    return LoadUsersFromFile(FileConstants::USERS_FILE);
+}
+
+LoadState UserManager::GetLoadState() const
+{
+    return m_loadState;
+}
+
 void UserManager::ShowUserManagementMenu()
 {
 }
@@ -6,6 +6,7 @@
 
 #pragma once
 #include "FileConstants.h"
+#include "LoadState.h"
 #include <string>
 #include <unordered_map>
 
@@ -39,6 +40,7 @@ struct UserData {
 class UserManager {
 private:
     std::unordered_map<std::string, UserData> m_users;  ///< Колекція користувачів
+    LoadState m_loadState;                               ///< Стан завантаження користувачів з файлу
 
     // Константи повідомлень
     static const std::string ERROR_EMPTY_USERNAME;     ///< Помилка: пусте ім'я користувача
@@ -78,6 +80,12 @@ public:
     /// @return Відповідна роль
     UserRole StringToRole(const std::string& roleStr) const;
 
+    /// @brief Формування рядка файлу користувачів
+    /// @param username Ім'я користувача
+    /// @param userData Дані користувача
+    /// @return Рядок "ім'я:пароль:роль" з екрануванням полів
+    std::string FormatUserRecord(const std::string& username, const UserData& userData) const;
+
     /// @brief Додавання нового користувача
     /// @param username Ім'я користувача
     /// @param password Пароль користувача
@@ -143,6 +151,14 @@ public:
     /// @return Результат операції
     std::string LoadUsersFromFile(const std::string& filename);
 
+    /// @brief Завантаження користувачів з файлу за замовчуванням, якщо їх ще не завантажено
+    /// @return Результат операції
+    std::string Open();
+
+    /// @brief Стан завантаження користувачів
+    /// @return Стан завантаження
+    LoadState GetLoadState() const;
+
     /// @brief Показ меню управління користувачами
     void ShowUserManagementMenu();
 
@@ -0,0 +1,169 @@
+/**
+ * @file ValueIndex.h
+ * @brief Заголовний файл для вторинного індексу за значенням поля запису
+ */
+
+#ifndef VALUEINDEX_H
+#define VALUEINDEX_H
+
+#include "SlotMap.h"
+#include <cstdint>
+#include <unordered_map>
+#include <vector>
+
+namespace University {
+
+/**
+ * @class ValueIndex
+ * @brief Групує дескриптори записів за значенням ключового поля
+ *
+ * Кожному різному значенню ключа відповідає група дескрипторів записів
+ * з цим значенням. Точний пошук - одне звернення до хеш-таблиці; пошук
+ * за частиною значення перебирає лише різні значення ключа, а не всі
+ * записи. Дескриптори не залежать від позицій записів, тож сортування
+ * колекції індекс не змінює. Для кожного слота зберігається позиція його
+ * дескриптора в групі, тож додавання і видалення запису виконуються за O(1)
+ * незалежно від розміру групи.
+ *
+ * @tparam Key Тип ключа (наприклад, символ освітньої програми)
+ * @tparam T Тип запису
+ */
+template <typename Key, typename T>
+class ValueIndex {
+public:
+    using KeyFunction = Key (*)(const T&);  ///< Обчислює ключ запису
+
+private:
+    KeyFunction m_keyOf;                                        ///< Функція ключа
+    std::unordered_map<Key, std::vector<Handle<T>>> m_groups;   ///< Ключ -> дескриптори записів
+    std::vector<uint32_t> m_memberPosition;                     ///< Слот -> позиція дескриптора в його групі
+    size_t m_size = 0;                                          ///< Загальна кількість дескрипторів
+
+    void Add(const Key& key, Handle<T> handle)
+    {
+        auto& members = m_groups[key];
+        if (handle.slot >= m_memberPosition.size())
+        {
+            m_memberPosition.resize(handle.slot + 1);
+        }
+        m_memberPosition[handle.slot] = static_cast<uint32_t>(members.size());
+        members.push_back(handle);
+        m_size++;
+    }
+
+    void Remove(const Key& key, Handle<T> handle)
+    {
+        auto group = m_groups.find(key);
+        if (group == m_groups.end() || handle.slot >= m_memberPosition.size())
+        {
+            return;
+        }
+        auto& members = group->second;
+        uint32_t position = m_memberPosition[handle.slot];
+        if (position >= members.size() || members[position] != handle)
+        {
+            return;
+        }
+        // Порядок у групі не важливий: результати впорядковуються за позиціями,
+        // тож на місце видаленого стає останній дескриптор групи - O(1) замість пошуку
+        members[position] = members.back();
+        m_memberPosition[members[position].slot] = position;
+        members.pop_back();
+        m_size--;
+        if (members.empty())
+        {
+            m_groups.erase(group);
+        }
+    }
+
+public:
+    /**
+     * @brief Конструктор з параметрами
+     * @param keyOf Функція, що обчислює ключ запису
+     */
+    explicit ValueIndex(KeyFunction keyOf) : m_keyOf(keyOf) {}
+
+    /**
+     * @brief Додає запис до групи його ключа
+     */
+    void Insert(const T& record, Handle<T> handle)
+    {
+        Add(m_keyOf(record), handle);
+    }
+
+    /**
+     * @brief Видаляє запис з групи його ключа
+     */
+    void Erase(const T& record, Handle<T> handle)
+    {
+        Remove(m_keyOf(record), handle);
+    }
+
+    /**
+     * @brief Очищає індекс
+     */
+    void Clear()
+    {
+        m_groups.clear();
+        m_memberPosition.clear();
+        m_size = 0;
+    }
+
+    /**
+     * @brief Повертає дескриптори записів з точним значенням ключа
+     * @return Група або nullptr, якщо таких записів немає
+     */
+    const std::vector<Handle<T>>* Find(const Key& key) const
+    {
+        auto group = m_groups.find(key);
+        return group != m_groups.end() ? &group->second : nullptr;
+    }
+
+    /**
+     * @brief Збирає дескриптори всіх груп, ключ яких задовольняє умову
+     * @param matches Умова, що перевіряється один раз для кожного різного ключа
+     */
+    template <typename Predicate>
+    std::vector<Handle<T>> Collect(Predicate matches) const
+    {
+        std::vector<Handle<T>> result;
+        for (const auto& group : m_groups)
+        {
+            if (matches(group.first))
+            {
+                result.insert(result.end(), group.second.begin(), group.second.end());
+            }
+        }
+        return result;
+    }
+
+    /**
+     * @brief Підраховує записи в групах, ключ яких задовольняє умову
+     * @details Використовується для оцінки вибірковості умови без збору дескрипторів.
+     */
+    template <typename Predicate>
+    size_t CountMatching(Predicate matches) const
+    {
+        size_t count = 0;
+        for (const auto& group : m_groups)
+        {
+            if (matches(group.first))
+            {
+                count += group.second.size();
+            }
+        }
+        return count;
+    }
+
+    /**
+     * @brief Повертає загальну кількість проіндексованих записів
+     */
+    size_t Size() const
+    {
+        return m_size;
+    }
+};
+
+} // namespace University
+
+#endif // VALUEINDEX_H
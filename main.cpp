@@ -4,21 +4,28 @@
 #include "UserManager.h"
 #include "DatabaseManager.h"
 #include "AssignmentManager.h"
+#include "ThreadPool.h"
+#include "LifecycleTrace.h"
 
 using namespace std;
 using namespace University;
 
 int main() {
-    // Налаштування для української мови
-    setlocale(LC_ALL, "uk_UA.UTF-8");
+    // Налаштування для української мови (до запуску будь-яких потоків)
+    Person::initializeUkrainianSupport();
 
     cout << " Запуск системи управління Навчальним Закладом..." << endl;
     cout << "=============================================" << endl;
 
     try {
 
+        // Спільний пул потоків для паралельного завантаження та перегляду колекцій
+        auto threadPool = make_unique<ThreadPool>();
         auto userManager = make_unique<UserManager>();
         auto dbManager = make_unique<DatabaseManager>();
+        dbManager->SetThreadPool(threadPool.get());
+        // Збереження змін виконується фоновим потоком, щоб не блокувати меню
+        dbManager->SetPersistenceMode(PersistenceMode::Background);
         auto assignmentManager = make_unique<AssignmentManager>();
 
 
@@ -39,6 +46,11 @@ int main() {
         return 1;
     }
 
+    // Звіт формується після знищення менеджерів, щоб врахувати всі об'єкти
+    if (LifecycleTrace::IsEnabled()) {
+        LifecycleTrace::PrintReport(cerr);
+    }
+
     cout << " Система завершила роботу успішно!" << endl;
     return 0;
 }
\ No newline at end of file